@@ -1,7 +1,17 @@
 #pragma once // Ensures this header file is included only once per compilation unit
 
+#include <cassert> // assert
+#include <cstddef> // std::size_t
+#include <cstring> // std::memcpy
+#include <iterator> // std::iterator_traits
+#include <new>     // ::operator new and ::operator delete
+#include <utility> // std::move, std::forward and std::swap
 #include <vector> 
 
+#if defined(__SSE4_1__)
+#include <smmintrin.h> // SSE4.1 intrinsics, used to select the smallest of 4 or 8 int children
+#endif
+
 // Comparator template structure
 template <typename E>
 struct Comparator {
@@ -12,14 +22,55 @@ struct Comparator {
     }
 };
 
-// Class representing a complete binary tree using a std::vector for storage.
-template <typename E>
+// Allocator for the element array of a VectorCompleteTree.
+// It places element 1 (the first child of the root) at the start of a LINE-byte cache line. In a d-ary
+// tree stored from index 0, the children of index i are D*i+1 ... D*i+D, so every group of siblings
+// then starts a cache line too, and when D * sizeof(T) is at most LINE all of them share one line.
+template <typename T>
+struct ChildAlignedAllocator {
+    typedef T value_type;
+    static const std::size_t LINE = 64; // Cache line size in bytes.
+
+    ChildAlignedAllocator() {}
+    template <typename U>
+    ChildAlignedAllocator(const ChildAlignedAllocator<U>&) {}
+
+    // Allocates room for n elements, plus slack for the alignment and for the address of the block,
+    // which is stored just before the returned pointer.
+    T* allocate(std::size_t n) {
+        char* raw = static_cast<char*>(::operator new(n * sizeof(T) + LINE + sizeof(void*)));
+        std::size_t first = reinterpret_cast<std::size_t>(raw) + sizeof(void*) + sizeof(T); // Earliest place for element 1.
+        first = (first + LINE - 1) / LINE * LINE;                                           // rounded up to a cache line.
+        char* p = reinterpret_cast<char*>(first - sizeof(T));
+        std::memcpy(p - sizeof(void*), &raw, sizeof(void*));
+        return reinterpret_cast<T*>(p);
+    }
+
+    // Frees an array returned by allocate().
+    void deallocate(T* p, std::size_t) {
+        char* raw;
+        std::memcpy(&raw, reinterpret_cast<char*>(p) - sizeof(void*), sizeof(void*));
+        ::operator delete(raw);
+    }
+
+    bool operator==(const ChildAlignedAllocator&) const { return true; }
+    bool operator!=(const ChildAlignedAllocator&) const { return false; }
+};
+
+// Class representing a complete D-ary tree (binary by default) using a std::vector for storage.
+// The root is stored at index 0 and the children of index i at D*i+1 ... D*i+D, so no unused
+// sentinel element is needed and E does not have to be default-constructible.
+// A larger D makes the tree shallower (log_D n levels), and since the siblings are adjacent and
+// start a cache line (see ChildAlignedAllocator), visiting all children of a node costs one miss.
+template <typename E, int D = 2>
 class VectorCompleteTree {
+    static_assert(D >= 2, "a complete tree needs at least 2 children per node");
+
 public:
     // Publicly accessible type alias for an iterator to elements in the tree.
-    typedef typename std::vector<E>::iterator PositionIterator;
+    typedef typename std::vector<E, ChildAlignedAllocator<E>>::iterator PositionIterator;
     // Publicly accessible type alias for a const_iterator to elements in the tree.
-    typedef typename std::vector<E>::const_iterator ConstPositionIterator;
+    typedef typename std::vector<E, ChildAlignedAllocator<E>>::const_iterator ConstPositionIterator;
 
     // It encapsulates a PositionIterator.
     class Position {
@@ -39,7 +90,7 @@ public:
     };
 
 private:
-    std::vector<E> V; // The std::vector used to store tree elements.
+    std::vector<E, ChildAlignedAllocator<E>> V; // The std::vector used to store tree elements.
 
 protected:
     // Protected utility function to map an index to a Position object.
@@ -53,13 +104,12 @@ protected:
     }
 
 public:
-    // Constructor: Initializes the vector V with one element
-    // This allows for 1-based indexing of heap elements, where the root is at index 1.
-    VectorCompleteTree() : V(1) {}
+    // Constructor: Creates an empty tree.
+    VectorCompleteTree() {}
 
-    // Returns the number of actual elements in the tree
+    // Returns the number of elements in the tree
     int size() const {
-        return V.size() - 1;
+        return V.size();
     }
 
     // Checks if the tree is empty.
@@ -67,45 +117,76 @@ public:
         return size() == 0;
     }
 
-    // Returns the Position of the left child of a given position p.
+    // Returns the Position of the k-th child (0 <= k < D) of a given position p.
+    Position child(const Position& p, int k) {
+        return pos(D * idx(p) + 1 + k);
+    }
+
+    // Returns the Position of the left (first) child of a given position p.
     Position left(const Position& p) {
-        return pos(2 * idx(p));
+        return child(p, 0);
     }
 
-    // Returns the Position of the right child of a given position p.
+    // Returns the Position of the right (second) child of a given position p.
     Position right(const Position& p) {
-        return pos(2 * idx(p) + 1);
+        return child(p, 1);
     }
 
     // Returns the Position of the parent of a given position p.
     Position parent(const Position& p) {
-        // Assumes idx(p)/2 is a valid index (root's parent would be index 0).
-        return pos(idx(p) / 2);
+        // Assumes p is not the root.
+        return pos((idx(p) - 1) / D);
+    }
+
+    // Returns the number of children (0 ... D) of the node at position p.
+    int childCount(const Position& p) const {
+        int n = size() - (D * idx(p) + 1);
+        return n < 0 ? 0 : (n > D ? D : n);
     }
 
-    // Checks if the node at position p has a left child.
+    // Checks if the node at position p has a left (first) child.
     bool hasLeft(const Position& p) const {
-        return 2 * idx(p) <= size();
+        return D * idx(p) + 1 < size();
     }
 
-    // Checks if the node at position p has a right child.
+    // Checks if the node at position p has a right (second) child.
     bool hasRight(const Position& p) const {
-        return 2 * idx(p) + 1 <= size();
+        return D * idx(p) + 2 < size();
     }
 
     // Checks if the node at position p is the root of the tree.
     bool isRoot(const Position& p) const {
-        return idx(p) == 1; // Root is at index 1
+        return idx(p) == 0; // Root is at index 0
+    }
+
+    // Returns the Position of the element at level-order index i (0 is the root).
+    Position at(int i) {
+        return pos(i);
+    }
+
+    // Returns the level-order index of the element at position p.
+    int index(const Position& p) const {
+        return idx(p);
     }
 
     // Returns the Position of the root element.
     Position root() {
-        return pos(1); // Root is at index 1
+        return pos(0); // Root is at index 0
+    }
+
+    // Returns a const reference to the root element.
+    const E& rootElement() const {
+        return V.front();
+    }
+
+    // Returns a const reference to the element at level-order index i.
+    const E& element(int i) const {
+        return V[i];
     }
 
     // Returns the Position of the last element in the tree (in level-order).
     Position last() {
-        return pos(size()); // Last element is at index 'size()'
+        return pos(size() - 1); // Last element is at index 'size() - 1'
     }
 
     // Adds an element 'e' to the end of the tree, maintaining completeness.
@@ -113,24 +194,91 @@ public:
         V.push_back(e);
     }
 
+    // Adds an element 'e' to the end of the tree by moving it in.
+    void addLast(E&& e) {
+        V.push_back(std::move(e));
+    }
+
+    // Constructs an element from 'args' directly at the end of the tree.
+    template <typename... Args>
+    void emplaceLast(Args&&... args) {
+        V.emplace_back(std::forward<Args>(args)...);
+    }
+
     // Removes the last element from the tree.
     void removeLast() {
         V.pop_back();
     }
 
     // Swaps the elements at two given positions p and q.
+    // std::swap moves the elements, so move-only types can be stored as well.
     void swap(const Position& p, const Position& q) {
-        E tempVal = *p; // Dereference p to get the element's value
-        *p = *q;    // Assign q's element value to p's element
-        *q = tempVal; // Assign original p's element value to q's element
+        using std::swap;
+        swap(*p, *q);
     }
 };
 
-// Class implementing a heap-based priority queue.
-// E is the element type, C is the comparator type.
+// Selects the child with the highest priority among the n (1 <= n <= D) adjacent children at c,
+// i.e. the first one that no other child is "less than" according to isLess, and returns its offset.
 template <typename E, typename C>
+struct MinChild {
+    static int select(const E* c, int n, const C& isLess) {
+        int best = 0;
+        for (int k = 1; k < n; k++) {
+            if (isLess(c[k], c[best])) best = k;
+        }
+        return best;
+    }
+};
+
+#if defined(__SSE4_1__)
+// Specialization for int keys compared with the default Comparator: a full group of 4 or 8 children
+// is reduced with SSE4.1 minimum instructions instead of a chain of dependent compares and branches.
+// The offset of the first child equal to the minimum is the same one the generic version returns.
+template <>
+struct MinChild<int, Comparator<int>> {
+    static int select(const int* c, int n, const Comparator<int>& isLess) {
+        if (n != 4 && n != 8) {          // Another arity, or the partial group of the last parent.
+            int best = 0;
+            for (int k = 1; k < n; k++) {
+                if (isLess(c[k], c[best])) best = k;
+            }
+            return best;
+        }
+        __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c));
+        __m128i m = lo;
+        if (n == 8) m = _mm_min_epi32(m, _mm_loadu_si128(reinterpret_cast<const __m128i*>(c + 4)));
+        m = _mm_min_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2))); // Minimum of all lanes,
+        m = _mm_min_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1))); // in every lane.
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(lo, m)));
+        if (n == 8) {
+            __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c + 4));
+            mask |= _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(hi, m))) << 4;
+        }
+        return __builtin_ctz(mask);      // The first lane holding the minimum.
+    }
+};
+#endif
+
+// Class implementing a heap-based priority queue.
+// E is the element type, C is the comparator type, D is the number of children per node.
+// Every member is defined in this header, so the queue works with any element type and comparator
+// (including move-only element types) and its operations can be inlined into the caller.
+// With D = 4 or 8 a removeMin on a large heap walks half or a third as many levels as with D = 2,
+// each level reading one cache line of children; insert gets cheaper as well. The children are
+// compared with MinChild, which uses SIMD instructions for int keys where available.
+template <typename E, typename C = Comparator<E>, int D = 2>
 class HeapPriorityQueue {
 public:
+    // Constructor: Creates an empty priority queue.
+    HeapPriorityQueue() {}
+
+    // Range constructor: Creates a priority queue holding the elements of [first, last), built
+    // with Floyd's bottom-up heapify in O(n) instead of n insertions in O(n log n).
+    // Wrap the iterators with std::make_move_iterator() to move the elements in.
+    template <typename It, typename = typename std::iterator_traits<It>::iterator_category>
+    HeapPriorityQueue(It first, It last, const C& comp = C());
+
     // Returns the number of elements in the priority queue.
     int size() const;
 
@@ -140,16 +288,480 @@ public:
     // Inserts an element 'e' into the priority queue.
     void insert(const E& e);
 
+    // Inserts an element 'e' into the priority queue by moving it in.
+    void insert(E&& e);
+
+    // Constructs an element from 'args' in the priority queue.
+    template <typename... Args>
+    void emplace(Args&&... args);
+
+    // Inserts the elements of [first, last). An empty queue, or a batch larger than the height of the
+    // tree, is ordered by a bottom-up heapify of the new elements and their ancestors, in about
+    // O(k + log^2 n) steps for k elements; a smaller batch is inserted one element at a time.
+    template <typename It>
+    void insertBatch(It first, It last);
+
     // Returns a const reference to the minimum element (highest priority).
-    const E& min();
+    const E& min() const;
 
     // Removes the minimum element (highest priority) from the queue.
     void removeMin();
 
 private:
-    VectorCompleteTree<E> T; // The underlying complete binary tree used to store heap elements.
+    VectorCompleteTree<E, D> T; // The underlying complete tree used to store heap elements.
     C isLess;                // The comparator object to determine priority 
 
     // Type alias for a position in the underlying tree, for convenience.
-    typedef typename VectorCompleteTree<E>::Position Position;
-};
\ No newline at end of file
+    typedef typename VectorCompleteTree<E, D>::Position Position;
+
+    // Restores the heap order after an element was added at the last position.
+    void upHeap();
+
+    // Moves the hole at 'v' up until 'x' can be placed in it, then moves 'x' there.
+    void siftUp(Position v, E& x);
+
+    // Moves the hole at 'u' down until 'x' can be placed in it, then moves 'x' there.
+    void siftDown(Position u, E& x);
+
+    // Restores the heap order after the elements [a, b), all on one level of the tree, were added to
+    // a heap of 'a' elements (or, if a is 0, orders the whole tree).
+    void heapify(int a, int b);
+};
+
+// Returns the number of elements in the priority queue.
+template <typename E, typename C, int D>
+inline int HeapPriorityQueue<E, C, D>::size() const {
+    return T.size();
+}
+
+// Checks if the priority queue is empty.
+template <typename E, typename C, int D>
+inline bool HeapPriorityQueue<E, C, D>::empty() const {
+    return T.empty();
+}
+
+// Returns a const reference to the minimum element in the priority queue.
+// For a min-heap, this is the element at the root.
+template <typename E, typename C, int D>
+inline const E& HeapPriorityQueue<E, C, D>::min() const {
+    return T.rootElement();
+}
+
+// Inserts an element 'e' into the priority queue and maintains the heap property.
+template <typename E, typename C, int D>
+inline void HeapPriorityQueue<E, C, D>::insert(const E& e) {
+    T.addLast(e);                     // Add the new element to the end of the complete tree.
+    upHeap();
+}
+
+// Inserts an element 'e' into the priority queue by moving it, and maintains the heap property.
+template <typename E, typename C, int D>
+inline void HeapPriorityQueue<E, C, D>::insert(E&& e) {
+    T.addLast(std::move(e));          // Move the new element to the end of the complete tree.
+    upHeap();
+}
+
+// Constructs an element from 'args' at the end of the tree and maintains the heap property.
+template <typename E, typename C, int D>
+template <typename... Args>
+inline void HeapPriorityQueue<E, C, D>::emplace(Args&&... args) {
+    T.emplaceLast(std::forward<Args>(args)...);
+    upHeap();
+}
+
+// Builds the queue from [first, last) with insertBatch(), which heapifies an empty queue at once.
+template <typename E, typename C, int D>
+template <typename It, typename>
+inline HeapPriorityQueue<E, C, D>::HeapPriorityQueue(It first, It last, const C& comp) : isLess(comp) {
+    insertBatch(first, last);
+}
+
+// Inserts a batch of elements.
+// Into an empty queue, all elements are appended and Floyd's heapify sifts down every parent,
+// from the last one to the root. Otherwise the batch is appended one tree level at a time, and
+// each level's new elements are ordered together with their ancestors (see heapify()): the new
+// elements of one level are contiguous, so are their parents, grandparents, and so on, which keeps
+// the work proportional to the batch plus one path per level. A batch no larger than the height of
+// the tree is inserted element by element instead, since those paths would then dominate.
+template <typename E, typename C, int D>
+template <typename It>
+inline void HeapPriorityQueue<E, C, D>::insertBatch(It first, It last) {
+    if (empty()) {
+        for (; first != last; ++first) T.emplaceLast(*first);
+        heapify(0, size());
+        return;
+    }
+    int height = 0;                   // Number of levels of the tree.
+    for (int n = size(); n > 0; n = (n - 1) / D) height++;
+    std::vector<E> small;             // Collect up to 'height' elements to see if the batch is small.
+    for (; first != last && int(small.size()) <= height; ++first) small.emplace_back(*first);
+    if (first == last && int(small.size()) <= height) {
+        for (E& e : small) insert(std::move(e));
+        return;
+    }
+    typename std::vector<E>::iterator s = small.begin(); // The collected elements go in first.
+    while (s != small.end() || first != last) {
+        int a = size();
+        int levelEnd = 0;             // First index of the level after the one holding index a.
+        while (levelEnd <= a) levelEnd = D * levelEnd + 1;
+        for (; size() < levelEnd && s != small.end(); ++s) T.addLast(std::move(*s));
+        for (; size() < levelEnd && first != last; ++first) T.emplaceLast(*first);
+        heapify(a, size());
+    }
+}
+
+// Up-heap bubbling of the element at the last position.
+template <typename E, typename C, int D>
+inline void HeapPriorityQueue<E, C, D>::upHeap() {
+    Position v = T.last();            // Get the Position of the newly added element.
+    E x = std::move(*v);              // Take it out, leaving a hole at 'v'.
+    siftUp(v, x);
+}
+
+// Up-heap bubbling with a hole instead of swaps: while the parent 'u' of the hole 'v' has lower
+// priority than 'x', the parent is moved down into the hole and the hole moves up to 'u'. Then 'x'
+// is moved into the hole. Every element on the path is moved once, instead of swapped (three moves).
+template <typename E, typename C, int D>
+inline void HeapPriorityQueue<E, C, D>::siftUp(Position v, E& x) {
+    while (!T.isRoot(v)) {
+        Position u = T.parent(v);   // Get the parent of v.
+        if (!isLess(x, *u)) {     // If x is not "less than" the parent (heap order is satisfied at this edge)
+            break;                  // ...stop the up-heap bubbling.
+        }
+        *v = std::move(*u);         // Otherwise, move the parent down into the hole,
+        v = u;                      // and move the hole up to the parent's position.
+    }
+    *v = std::move(x);              // Place x once, at its final position.
+}
+
+// Down-heap bubbling with a hole: while the child 'v' of the hole 'u' with the highest priority has
+// higher priority than 'x', that child is moved up into the hole and the hole moves down to 'v'.
+// Then 'x' is moved into the hole.
+template <typename E, typename C, int D>
+inline void HeapPriorityQueue<E, C, D>::siftDown(Position u, E& x) {
+    while (T.hasLeft(u)) {        // While 'u' has at least one child:
+        Position first = T.left(u); // The children of 'u' are adjacent, starting at 'first';
+                                    // 'v' becomes the one with the highest priority.
+        Position v = T.child(u, MinChild<E, C>::select(&*first, T.childCount(u), isLess));
+        if (!isLess(*v, x)) {       // If 'v' does not have higher priority than x, the hole is x's place.
+            break;
+        }
+        *u = std::move(*v);         // Otherwise move 'v' up into the hole,
+        u = v;                      // and move the hole down to 'v's position.
+    }
+    *u = std::move(x);              // Place x once, at its final position.
+}
+
+// Bottom-up heapify of the new elements [a, b) and their ancestors.
+// The parents of the new elements, lo ... hi, are sifted down from right to left, then their parents,
+// and so on up to the root. Each range covers one level, so every node is sifted down after all of
+// its descendants, and its subtrees are heaps by then. With a = 0 there is a single range, every
+// parent in the tree: Floyd's heapify.
+template <typename E, typename C, int D>
+inline void HeapPriorityQueue<E, C, D>::heapify(int a, int b) {
+    if (b < 2) return;                // Nothing to order.
+    int lo = a > 0 ? (a - 1) / D : 0; // Parent of the first new element,
+    int hi = (b - 2) / D;             // and of the last one.
+    for (;;) {
+        for (int i = hi; i >= lo; i--) {
+            Position u = T.at(i);
+            E x = std::move(*u);
+            siftDown(u, x);
+        }
+        if (lo == 0) break;
+        lo = (lo - 1) / D;
+        hi = (hi - 1) / D;
+    }
+}
+
+// Removes the minimum element (highest priority) from the priority queue
+// and maintains the heap property.
+// though the T.removeLast() or T.root() might handle some cases or throw.
+template <typename E, typename C, int D>
+inline void HeapPriorityQueue<E, C, D>::removeMin() {
+    // If there's only one element, simply remove it.
+    if (size() == 1) {
+        T.removeLast();
+    } else {
+        E x = std::move(*T.last());     // Take out the last element,
+        T.removeLast();                 // and shrink the tree by one.
+
+        // Down-heap bubbling process:
+        // The root (the element to be removed) becomes a hole that moves down towards the leaves,
+        // pulling up the child of higher priority at each level, until the last element 'x'
+        // fits into it. The removed minimum is simply overwritten.
+        siftDown(T.root(), x);
+    }
+}
+
+// Class implementing an addressable heap-based priority queue.
+// insert() returns a Handle that keeps referring to the inserted element while the heap moves it
+// around, so its priority can be changed (decreaseKey(), increaseKey()) or it can be removed
+// (erase()) in O(log n), e.g. for Dijkstra's algorithm or rescheduling deadlines, instead of
+// inserting duplicates and skipping the stale ones. Each element is stored next to its handle
+// number, and 'where' maps every handle number to the element's index in the tree; the sift
+// functions update it for every element they move. Handle numbers are reused by later inserts,
+// so every number also has a generation, incremented when its element is removed, and a handle
+// only refers to an element while its generation is current: a handle to a removed element is
+// never taken for the element that reuses its number.
+template <typename E, typename C = Comparator<E>, int D = 2>
+class AddressableHeapPriorityQueue {
+public:
+    // Refers to an element of the queue.
+    class Handle {
+    public:
+        // Constructor: Creates a handle that refers to no element.
+        Handle() : id(-1), gen(0) {}
+
+        // Equality operator: Checks if this Handle refers to the same element as another.
+        bool operator==(const Handle& other) const { return id == other.id && gen == other.gen; }
+        // Inequality operator: Checks if this Handle refers to a different element than another.
+        bool operator!=(const Handle& other) const { return !(*this == other); }
+
+    private:
+        Handle(int _id, unsigned _gen) : id(_id), gen(_gen) {}
+        int id;       // Index into 'where' and 'gens'.
+        unsigned gen; // The generation of the number 'id' when the element was inserted.
+
+        friend class AddressableHeapPriorityQueue;
+    };
+
+    // Returns the number of elements in the priority queue.
+    int size() const;
+
+    // Checks if the priority queue is empty.
+    bool empty() const;
+
+    // Checks if handle 'h' refers to an element of the queue, i.e. the element has not been removed.
+    bool contains(Handle h) const;
+
+    // Inserts an element 'e' into the priority queue and returns its handle.
+    Handle insert(const E& e);
+
+    // Inserts an element 'e' into the priority queue by moving it in, and returns its handle.
+    Handle insert(E&& e);
+
+    // Returns a const reference to the element referred to by 'h', which must be in the queue.
+    const E& get(Handle h) const;
+
+    // Returns a const reference to the minimum element (highest priority).
+    const E& min() const;
+
+    // Returns the handle of the minimum element (highest priority).
+    Handle minHandle() const;
+
+    // Removes the minimum element (highest priority) from the queue.
+    void removeMin();
+
+    // Replaces the element referred to by 'h' with 'e', which must not have lower priority.
+    // Returns false, and changes nothing, if 'h' does not refer to an element of the queue.
+    bool decreaseKey(Handle h, E e);
+
+    // Replaces the element referred to by 'h' with 'e', which must not have higher priority.
+    // Returns false, and changes nothing, if 'h' does not refer to an element of the queue.
+    bool increaseKey(Handle h, E e);
+
+    // Removes the element referred to by 'h' from the queue.
+    // Returns false, and changes nothing, if 'h' does not refer to an element of the queue.
+    bool erase(Handle h);
+
+private:
+    // An element together with the number of its handle.
+    struct Slot {
+        E e;
+        int id;
+    };
+
+    // Compares slots by their elements.
+    struct SlotLess {
+        C isLess;
+        bool operator()(const Slot& a, const Slot& b) const { return isLess(a.e, b.e); }
+    };
+
+    VectorCompleteTree<Slot, D> T; // The underlying complete tree used to store heap elements.
+    SlotLess isLess;               // The comparator object to determine priority
+    std::vector<int> where;        // where[id]: the tree index of the element of handle 'id', or -1.
+    std::vector<unsigned> gens;    // gens[id]: the current generation of handle number 'id'.
+    std::vector<int> freeIds;      // Handle numbers not in use.
+
+    // Type alias for a position in the underlying tree, for convenience.
+    typedef typename VectorCompleteTree<Slot, D>::Position Position;
+
+    // Adds slot 'x' at the last position and returns its handle.
+    Handle add(Slot&& x);
+
+    // Moves slot 'x' into the hole at 'v' and records its new index.
+    void place(Position v, Slot&& x);
+
+    // Removes the element at position 'v', whose handle has already been released.
+    void removeAt(Position v);
+
+    // Moves the hole at 'v' up until 'x' can be placed in it, then moves 'x' there.
+    void siftUp(Position v, Slot& x);
+
+    // Moves the hole at 'u' down until 'x' can be placed in it, then moves 'x' there.
+    void siftDown(Position u, Slot& x);
+};
+
+// Returns the number of elements in the priority queue.
+template <typename E, typename C, int D>
+inline int AddressableHeapPriorityQueue<E, C, D>::size() const {
+    return T.size();
+}
+
+// Checks if the priority queue is empty.
+template <typename E, typename C, int D>
+inline bool AddressableHeapPriorityQueue<E, C, D>::empty() const {
+    return T.empty();
+}
+
+// Checks if 'h' refers to an element: its number is in use, and by the same generation.
+template <typename E, typename C, int D>
+inline bool AddressableHeapPriorityQueue<E, C, D>::contains(Handle h) const {
+    return h.id >= 0 && h.id < int(where.size()) && where[h.id] >= 0 && gens[h.id] == h.gen;
+}
+
+// Inserts a copy of 'e'.
+template <typename E, typename C, int D>
+inline typename AddressableHeapPriorityQueue<E, C, D>::Handle AddressableHeapPriorityQueue<E, C, D>::insert(const E& e) {
+    return add(Slot{ e, -1 });
+}
+
+// Inserts 'e' by moving it.
+template <typename E, typename C, int D>
+inline typename AddressableHeapPriorityQueue<E, C, D>::Handle AddressableHeapPriorityQueue<E, C, D>::insert(E&& e) {
+    return add(Slot{ std::move(e), -1 });
+}
+
+// Returns the element at the index recorded for 'h'.
+template <typename E, typename C, int D>
+inline const E& AddressableHeapPriorityQueue<E, C, D>::get(Handle h) const {
+    assert(contains(h));
+    return T.element(where[h.id]).e;
+}
+
+// Returns a const reference to the minimum element in the priority queue.
+// For a min-heap, this is the element at the root.
+template <typename E, typename C, int D>
+inline const E& AddressableHeapPriorityQueue<E, C, D>::min() const {
+    return T.rootElement().e;
+}
+
+// Returns the handle stored with the root element.
+template <typename E, typename C, int D>
+inline typename AddressableHeapPriorityQueue<E, C, D>::Handle AddressableHeapPriorityQueue<E, C, D>::minHandle() const {
+    int id = T.rootElement().id;
+    return Handle(id, gens[id]);
+}
+
+// Removes the root element and releases its handle.
+template <typename E, typename C, int D>
+inline void AddressableHeapPriorityQueue<E, C, D>::removeMin() {
+    erase(minHandle());
+}
+
+// A higher priority can only violate the heap order towards the root: the element is sifted up.
+template <typename E, typename C, int D>
+inline bool AddressableHeapPriorityQueue<E, C, D>::decreaseKey(Handle h, E e) {
+    if (!contains(h)) return false;
+    Position v = T.at(where[h.id]);
+    Slot x{ std::move(e), h.id };
+    siftUp(v, x);
+    return true;
+}
+
+// A lower priority can only violate the heap order towards the leaves: the element is sifted down.
+template <typename E, typename C, int D>
+inline bool AddressableHeapPriorityQueue<E, C, D>::increaseKey(Handle h, E e) {
+    if (!contains(h)) return false;
+    Position u = T.at(where[h.id]);
+    Slot x{ std::move(e), h.id };
+    siftDown(u, x);
+    return true;
+}
+
+// Releases the handle number, starting its next generation, then removes the element at its index.
+template <typename E, typename C, int D>
+inline bool AddressableHeapPriorityQueue<E, C, D>::erase(Handle h) {
+    if (!contains(h)) return false;
+    Position v = T.at(where[h.id]);
+    where[h.id] = -1;
+    gens[h.id]++;
+    freeIds.push_back(h.id);
+    removeAt(v);
+    return true;
+}
+
+// Gives slot 'x' a free handle number (or a new one), adds it at the end of the tree and bubbles it up.
+template <typename E, typename C, int D>
+inline typename AddressableHeapPriorityQueue<E, C, D>::Handle AddressableHeapPriorityQueue<E, C, D>::add(Slot&& x) {
+    int id;
+    if (freeIds.empty()) {
+        id = int(where.size());
+        where.push_back(-1);
+        gens.push_back(0);
+    } else {
+        id = freeIds.back();
+        freeIds.pop_back();
+    }
+    x.id = id;
+    T.addLast(std::move(x));
+    Position v = T.last();
+    Slot y = std::move(*v);           // Take it out, leaving a hole at 'v'.
+    siftUp(v, y);
+    return Handle(id, gens[id]);
+}
+
+// Moves 'x' into 'v' and updates the index of its handle.
+template <typename E, typename C, int D>
+inline void AddressableHeapPriorityQueue<E, C, D>::place(Position v, Slot&& x) {
+    *v = std::move(x);
+    where[(*v).id] = T.index(v);
+}
+
+// The last element fills the hole at 'v'. It may belong above or below it: it comes from another
+// subtree, so it is sifted up if it has higher priority than the parent of 'v', and down otherwise.
+template <typename E, typename C, int D>
+inline void AddressableHeapPriorityQueue<E, C, D>::removeAt(Position v) {
+    if (v == T.last()) {              // The last element needs no replacement.
+        T.removeLast();
+        return;
+    }
+    int i = T.index(v);
+    Slot x = std::move(*T.last());    // Take out the last element,
+    T.removeLast();                   // and shrink the tree by one.
+    v = T.at(i);
+    if (!T.isRoot(v) && isLess(x, *T.parent(v))) siftUp(v, x);
+    else siftDown(v, x);
+}
+
+// Up-heap bubbling with a hole, as in HeapPriorityQueue::siftUp(), recording the index of every
+// element moved.
+template <typename E, typename C, int D>
+inline void AddressableHeapPriorityQueue<E, C, D>::siftUp(Position v, Slot& x) {
+    while (!T.isRoot(v)) {
+        Position u = T.parent(v);   // Get the parent of v.
+        if (!isLess(x, *u)) {       // If the heap order is satisfied at this edge, stop.
+            break;
+        }
+        place(v, std::move(*u));    // Otherwise, move the parent down into the hole,
+        v = u;                      // and move the hole up to the parent's position.
+    }
+    place(v, std::move(x));         // Place x once, at its final position.
+}
+
+// Down-heap bubbling with a hole, as in HeapPriorityQueue::siftDown(), recording the index of every
+// element moved.
+template <typename E, typename C, int D>
+inline void AddressableHeapPriorityQueue<E, C, D>::siftDown(Position u, Slot& x) {
+    while (T.hasLeft(u)) {          // While 'u' has at least one child:
+        Position first = T.left(u); // 'v' becomes the child of 'u' with the highest priority.
+        Position v = T.child(u, MinChild<Slot, SlotLess>::select(&*first, T.childCount(u), isLess));
+        if (!isLess(*v, x)) {       // If 'v' does not have higher priority than x, the hole is x's place.
+            break;
+        }
+        place(u, std::move(*v));    // Otherwise move 'v' up into the hole,
+        u = v;                      // and move the hole down to 'v's position.
+    }
+    place(u, std::move(x));         // Place x once, at its final position.
+}
\ No newline at end of file
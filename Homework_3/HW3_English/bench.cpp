@@ -0,0 +1,236 @@
+// Microbenchmark driver for the hash maps of this directory, compared against std::unordered_map.
+// It is a separate program from main.cpp; build it with optimizations, for example:
+//     g++ -O2 -std=c++17 bench.cpp hashMap.cpp flatHashMap.cpp poolAllocator.cpp hashStats.cpp stringHashMap.cpp cuckooHashMap.cpp -o bench
+// Usage: bench [maxKeys] [minKeys]   (defaults: 1000000 and 1000; key counts grow by a factor of 10, up to 1e8)
+//
+// For every key type, key count and maximum load factor it measures put (into an empty map), find of present keys,
+// find of absent keys, erase and a full iteration, and prints the throughput and the p50/p99 latency of each.
+// A single operation is far shorter than a clock read, so latencies are measured over batches of BATCH operations
+// and reported per operation; p99 is therefore the 99th percentile of batch averages. Memory per entry is the growth
+// of the heap while the map is built, divided by the number of entries (it includes copies of long keys).
+
+#include "hashMap.h"     // Includes HashMap, stringHash and fastStringHash.
+#include "flatHashMap.h" // Includes FlatHashMap.
+#include "stringHashMap.h" // Includes StringHashMap.
+#include "cuckooHashMap.h" // Includes CuckooHashMap.
+
+#include <algorithm>     // Includes std::sort, std::shuffle and std::max.
+#include <chrono>        // Includes std::chrono::steady_clock.
+#include <cstdint>       // Includes std::uintptr_t.
+#include <cstdio>        // Includes std::printf.
+#include <cstdlib>       // Includes std::malloc, std::aligned_alloc, std::free and std::atof.
+#include <new>           // Includes std::bad_alloc and std::align_val_t.
+#include <random>        // Includes std::mt19937_64.
+#include <string>        // Includes std::string.
+#include <unordered_map> // Includes std::unordered_map, the baseline.
+#include <vector>        // Includes std::vector.
+
+// Heap accounting. Every allocation of the program goes through the operators below, which keep (liveBytes) equal
+// to the number of bytes currently allocated. The benchmark is single-threaded, so a plain counter suffices.
+static std::size_t liveBytes = 0;
+static const std::size_t HEADER = alignof(std::max_align_t); // Room in front of every block for its size.
+
+void* operator new(std::size_t size) {
+    void* p = std::malloc(size + HEADER);
+    if (p == nullptr) throw std::bad_alloc();
+    *static_cast<std::size_t*>(p) = size; // Remember the size for operator delete.
+    liveBytes += size;
+    return static_cast<char*>(p) + HEADER;
+}
+
+void operator delete(void* p) noexcept {
+    if (p == nullptr) return;
+    // Step back to the start of the block through an integer, so the compiler does not mistake the header for an
+    // access before the start of the object that was freed.
+    std::size_t* block = reinterpret_cast<std::size_t*>(reinterpret_cast<std::uintptr_t>(p) - HEADER);
+    liveBytes -= *block;
+    std::free(block);
+}
+
+void operator delete(void* p, std::size_t) noexcept { operator delete(p); }
+
+// Over-aligned types (such as the 64-byte buckets of CuckooHashMap) use these overloads instead. The header is
+// widened to the alignment, so the block stays aligned and its size still sits at the start of the block.
+void* operator new(std::size_t size, std::align_val_t align) {
+    std::size_t header = std::max(std::size_t(align), HEADER);
+    std::size_t total = (size + header + header - 1) / header * header; // A multiple of the alignment, as required.
+    void* p = std::aligned_alloc(header, total);
+    if (p == nullptr) throw std::bad_alloc();
+    *static_cast<std::size_t*>(p) = size;
+    liveBytes += size;
+    return static_cast<char*>(p) + header;
+}
+
+void operator delete(void* p, std::align_val_t align) noexcept {
+    if (p == nullptr) return;
+    std::size_t header = std::max(std::size_t(align), HEADER);
+    std::size_t* block = reinterpret_cast<std::size_t*>(reinterpret_cast<std::uintptr_t>(p) - header);
+    liveBytes -= *block;
+    std::free(block);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t align) noexcept { operator delete(p, align); }
+
+typedef std::chrono::steady_clock Clock;
+
+static const int BATCH = 32;            // Operations per latency sample.
+static const long MIN_OPS = 1L << 21;   // Every operation is repeated until at least this many were timed.
+static volatile long sink;              // Keeps the results of lookups alive.
+
+// The result of one measurement: throughput and latency percentiles, in nanoseconds per operation.
+struct Result {
+    double mops = 0; // Million operations per second.
+    double p50 = 0;  // Median latency.
+    double p99 = 0;  // 99th percentile latency.
+};
+
+// Accumulates latency samples (nanoseconds per operation) and the total time and operation count.
+class Samples {
+public:
+    // Records a batch of (ops) operations that took (ns) nanoseconds.
+    void add(double ns, long ops) {
+        lat.push_back(ns / ops);
+        totalNs += ns;
+        totalOps += ops;
+    }
+
+    // Computes the throughput and the percentiles of the recorded samples.
+    Result result() {
+        Result r;
+        if (lat.empty()) return r;
+        std::sort(lat.begin(), lat.end());
+        r.mops = totalOps / totalNs * 1e3;
+        r.p50 = lat[lat.size() / 2];
+        r.p99 = lat[std::min(lat.size() - 1, lat.size() * 99 / 100)];
+        return r;
+    }
+
+private:
+    std::vector<double> lat; // Latency of every sample.
+    double totalNs = 0;      // Sum of all samples.
+    long totalOps = 0;       // Number of operations in all samples.
+};
+
+// Runs op(order[i]) for every i, timing batches of BATCH operations into (s).
+template <typename F>
+void timeBatches(const std::vector<int>& order, Samples& s, F op) {
+    for (std::size_t i = 0; i < order.size(); i += BATCH) {
+        std::size_t end = std::min(order.size(), i + BATCH);
+        Clock::time_point t0 = Clock::now();
+        for (std::size_t j = i; j < end; j++) op(order[j]);
+        Clock::time_point t1 = Clock::now();
+        s.add(std::chrono::duration<double, std::nano>(t1 - t0).count(), long(end - i));
+    }
+}
+
+// Adapters: the maps of this directory share one interface; std::unordered_map gets its own overloads, which are
+// preferred by overload resolution because they are more specialized.
+template <typename M> void setLoad(M& m, float f) { m.setMaxLoadFactor(f); }
+template <typename K, typename V, typename H> void setLoad(FlatHashMap<K, V, H>&, float) { } // Fixed at 7/8.
+template <typename K, typename V, typename H> void setLoad(CuckooHashMap<K, V, H>&, float) { } // Fixed at 0.9.
+template <typename K, typename V, typename H> void setLoad(std::unordered_map<K, V, H>& m, float f) { m.max_load_factor(f); }
+
+template <typename M> void insertKey(M& m, const std::string& k, int v) { m.put(k, v); }
+template <typename K, typename V, typename H> void insertKey(std::unordered_map<K, V, H>& m, const std::string& k, int v) { m.insert_or_assign(k, v); }
+
+template <typename M> bool hasKey(M& m, const std::string& k) { return !(m.find(k) == m.end()); }
+template <typename K, typename V, typename H> bool hasKey(std::unordered_map<K, V, H>& m, const std::string& k) { return m.find(k) != m.end(); }
+
+template <typename M> long sumValues(M& m) {
+    long s = 0;
+    for (typename M::Iterator it = m.begin(); !(it == m.end()); ++it) s += (*it).value();
+    return s;
+}
+template <typename K, typename V, typename H> long sumValues(std::unordered_map<K, V, H>& m) {
+    long s = 0;
+    for (const auto& e : m) s += e.second;
+    return s;
+}
+
+// Builds (n) distinct keys; long keys share a 32-byte prefix, like hierarchical identifiers, and do not fit the
+// small-string buffer of std::string. (salt) tells hits and misses apart.
+static std::vector<std::string> makeKeys(int n, bool longKeys, const char* salt) {
+    std::vector<std::string> keys;
+    keys.reserve(n);
+    for (int i = 0; i < n; i++) {
+        std::string id = std::to_string(std::uint64_t(i) * 0x9E3779B97F4A7C15ull % 1000000007ull) + salt;
+        keys.push_back(longKeys ? "tenant/eu-west-1/accounts/active/" + id : id);
+    }
+    return keys;
+}
+
+// Benchmarks map type M on the given keys at maximum load factor (load) and prints one line per operation.
+template <typename M>
+void run(const char* name, const char* keyType, float load,
+         const std::vector<std::string>& keys, const std::vector<std::string>& misses, std::mt19937_64& rng) {
+    int n = int(keys.size());
+    std::vector<int> order(n);
+    for (int i = 0; i < n; i++) order[i] = i;
+    long rounds = std::max(1L, MIN_OPS / n); // Small maps are rebuilt several times to collect enough samples.
+    Samples put, hit, miss, erase, iterate;
+    double bytesPerEntry = 0;
+    for (long r = 0; r < rounds; r++) {
+        std::size_t before = liveBytes;
+        M* m = new M();
+        setLoad(*m, load);
+        std::shuffle(order.begin(), order.end(), rng);
+        timeBatches(order, put, [&](int i) { insertKey(*m, keys[i], i); });
+        if (r == 0) bytesPerEntry = double(liveBytes - before) / n;
+
+        std::shuffle(order.begin(), order.end(), rng);
+        long found = 0;
+        timeBatches(order, hit, [&](int i) { found += hasKey(*m, keys[i]); });
+        timeBatches(order, miss, [&](int i) { found += hasKey(*m, misses[i]); });
+        sink = found;
+
+        Clock::time_point t0 = Clock::now();  // Iteration is timed as whole passes over the map.
+        sink = sumValues(*m);
+        iterate.add(std::chrono::duration<double, std::nano>(Clock::now() - t0).count(), n);
+
+        std::shuffle(order.begin(), order.end(), rng);
+        timeBatches(order, erase, [&](int i) { m->erase(keys[i]); });
+        delete m;
+    }
+    const char* ops[] = { "put", "find hit", "find miss", "erase", "iterate" };
+    Samples* samples[] = { &put, &hit, &miss, &erase, &iterate };
+    for (int i = 0; i < 5; i++) {
+        Result res = samples[i]->result();
+        std::printf("%-24s %-6s %10d %5.2f %-10s %9.2f %9.1f %9.1f %9.1f\n", name, keyType, n, load, ops[i],
+                    res.mops, res.p50, res.p99, bytesPerEntry);
+    }
+}
+
+typedef HashMap<std::string, int, stringHash> ChainMap;
+typedef HashMap<std::string, int, fastStringHash> FastChainMap;
+typedef FlatHashMap<std::string, int, fastStringHash> FlatMap;
+typedef StringHashMap<int, fastStringHash> StringMap;
+typedef CuckooHashMap<std::string, int, fastStringHash> CuckooMap;
+typedef std::unordered_map<std::string, int> StdMap;
+
+int main(int argc, char** argv) {
+    double maxKeys = argc > 1 ? std::atof(argv[1]) : 1e6; // Largest key count.
+    double minKeys = argc > 2 ? std::atof(argv[2]) : 1e3; // Smallest key count.
+    if (maxKeys > 1e8) maxKeys = 1e8;
+    if (minKeys < 1) minKeys = 1;
+    std::mt19937_64 rng(12345);
+    const float loads[] = { 0.5f, 1.0f, 2.0f };
+
+    std::printf("%-24s %-6s %10s %5s %-10s %9s %9s %9s %9s\n", "map", "keys", "n", "load", "op",
+                "Mops/s", "p50 ns", "p99 ns", "B/entry");
+    for (int longKeys = 0; longKeys < 2; longKeys++) {
+        const char* keyType = longKeys ? "long" : "short";
+        for (double n = minKeys; n <= maxKeys; n *= 10) {
+            std::vector<std::string> keys = makeKeys(int(n), longKeys != 0, "");
+            std::vector<std::string> misses = makeKeys(int(n), longKeys != 0, "x");
+            for (float load : loads) {
+                run<ChainMap>("HashMap<stringHash>", keyType, load, keys, misses, rng);
+                run<FastChainMap>("HashMap<fastStringHash>", keyType, load, keys, misses, rng);
+                run<StringMap>("StringHashMap", keyType, load, keys, misses, rng);
+                run<StdMap>("std::unordered_map", keyType, load, keys, misses, rng);
+            }
+            run<FlatMap>("FlatHashMap", keyType, 0.875f, keys, misses, rng); // Their load factors are fixed.
+            run<CuckooMap>("CuckooHashMap", keyType, 0.9f, keys, misses, rng);
+        }
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include "concurrentHashMap.h" // Includes the definition of the ConcurrentHashMap class.
+
+#include <utility> // Includes std::move.
+
+// ConcurrentHashMap constructor implementation: 
+// Rounds the shard count up to a power of two and splits the initial capacity evenly among the shards. 
+template <typename K, typename V, typename H>
+ConcurrentHashMap<K, V, H>::ConcurrentHashMap(int shards, int capacity) : shardBits(0) {
+    while ((1 << shardBits) < shards) shardBits++;   // Smallest power of two >= shards. 
+    this->shards.reset(new Shard[1 << shardBits]);   // Every shard starts with a default HashMap, 
+    int perShard = capacity / shardCount() + 1;      // which is then sized for its share of the capacity. 
+    for (int s = 0; s < shardCount(); s++)
+        this->shards[s].map.reserve(perShard);
+}
+
+// shardCount() function implementation: 
+// Returns the number of shards. 
+template <typename K, typename V, typename H>
+int ConcurrentHashMap<K, V, H>::shardCount() const { return 1 << shardBits; }
+
+// shardOf() function implementation: 
+// Multiplies the hash by 2^64 / golden ratio and takes the top bits. The shard's HashMap picks a bucket from the low
+// bits of the same hash, so using the high bits here keeps the two choices independent. 
+template <typename K, typename V, typename H>
+typename ConcurrentHashMap<K, V, H>::Shard& ConcurrentHashMap<K, V, H>::shardOf(const LookupKey& k) const {
+    if (shardBits == 0) return shards[0]; // A single shard needs no selection (and a 64-bit shift would be undefined). 
+    unsigned long long x = hash(k) * 0x9E3779B97F4A7C15ull;
+    return shards[int(x >> (64 - shardBits))];
+}
+
+// size() function implementation: 
+// Adds up the shard sizes, reading each one under its lock. 
+template <typename K, typename V, typename H>
+int ConcurrentHashMap<K, V, H>::size() const {
+    int total = 0;
+    for (int s = 0; s < shardCount(); s++) {
+        std::shared_lock<std::shared_mutex> guard(shards[s].lock);
+        total += shards[s].map.size();
+    }
+    return total;
+}
+
+// empty() function implementation: 
+// Checks if every shard is empty. 
+template <typename K, typename V, typename H>
+bool ConcurrentHashMap<K, V, H>::empty() const { return size() == 0; }
+
+// find() function implementation: 
+// Looks key (k) up in its shard under a shared lock and copies the value out before releasing it. 
+template <typename K, typename V, typename H>
+bool ConcurrentHashMap<K, V, H>::find(const LookupKey& k, V& v) const {
+    Shard& s = shardOf(k);
+    std::shared_lock<std::shared_mutex> guard(s.lock); // Other readers of this shard are not blocked. 
+    typename Map::Iterator p = s.map.find(k);
+    if (p == s.map.end()) return false;                // Key (k) is absent. 
+    v = (*p).value();                                  // Copy while the entry is protected. 
+    return true;
+}
+
+// contains() function implementation: 
+// Checks for key (k) under a shared lock. 
+template <typename K, typename V, typename H>
+bool ConcurrentHashMap<K, V, H>::contains(const LookupKey& k) const {
+    Shard& s = shardOf(k);
+    std::shared_lock<std::shared_mutex> guard(s.lock);
+    return !(s.map.find(k) == s.map.end());
+}
+
+// put() function implementation: 
+// Inserts or replaces (k, v) in the shard of key (k) under an exclusive lock. 
+template <typename K, typename V, typename H>
+void ConcurrentHashMap<K, V, H>::put(const K& k, const V& v) {
+    Shard& s = shardOf(k);
+    std::unique_lock<std::shared_mutex> guard(s.lock); // Only this shard is locked. 
+    s.map.put(k, v);
+}
+
+// put(K&&, V&&) function implementation: 
+// Same as put() above, but moves the key and the value into the shard. 
+template <typename K, typename V, typename H>
+void ConcurrentHashMap<K, V, H>::put(K&& k, V&& v) {
+    Shard& s = shardOf(k);
+    std::unique_lock<std::shared_mutex> guard(s.lock);
+    s.map.put(std::move(k), std::move(v));
+}
+
+// erase() function implementation: 
+// Removes key (k) from its shard under an exclusive lock. 
+template <typename K, typename V, typename H>
+bool ConcurrentHashMap<K, V, H>::erase(const LookupKey& k) {
+    Shard& s = shardOf(k);
+    std::unique_lock<std::shared_mutex> guard(s.lock);
+    typename Map::Iterator p = s.map.find(k);
+    if (p == s.map.end()) return false; // Nothing to erase. 
+    s.map.erase(p);
+    return true;
+}
+
+// Explicit instantiation of the ConcurrentHashMap template for std::string keys and int values. 
+template class ConcurrentHashMap<std::string, int, stringHash>;
+template class ConcurrentHashMap<std::string, int, fastStringHash>;
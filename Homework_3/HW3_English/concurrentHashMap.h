@@ -0,0 +1,87 @@
+#pragma once // Ensures this header file is included only once.
+
+#include "hashMap.h" // Each shard is an ordinary HashMap.
+
+#include <cstddef>      // Includes std::size_t.
+#include <memory>       // Includes std::unique_ptr, which owns the shard array.
+#include <mutex>        // Includes std::unique_lock.
+#include <shared_mutex> // Includes std::shared_mutex and std::shared_lock.
+
+// Template class ConcurrentHashMap. A thread-safe map that stripes its keys over independent shards, each a HashMap
+// guarded by its own reader/writer lock. Operations on keys in different shards never contend, and readers of the
+// same shard proceed in parallel, so throughput grows with the number of cores instead of serializing on one lock.
+// Since another thread may erase an entry at any moment, lookups copy the value out instead of returning iterators.
+template <typename K, typename V, typename H>
+class ConcurrentHashMap {
+public:
+    typedef typename HashMap<K, V, H>::Entry Entry;     // Defines Entry type to represent a (key,value) pair. 
+    typedef typename LookupKeyOf<K, H>::type LookupKey; // Type accepted by find(), contains() and erase(). 
+
+public:
+    // Constructor: Creates (shards) shards (rounded up to a power of two, default 16) sharing an initial
+    // capacity of (capacity) entries. Use a few shards per core for write-heavy loads. 
+    ConcurrentHashMap(int shards = 16, int capacity = 100);
+
+    // Returns the number of entries. Under concurrent updates the result is only a snapshot. 
+    int size() const;
+
+    // Returns true if the map is empty (with the same caveat as size()). 
+    bool empty() const;
+
+    // Returns the number of shards. 
+    int shardCount() const;
+
+    // Finds the entry with key k; if it exists, copies its value into (v) and returns true. 
+    bool find(const LookupKey& k, V& v) const;
+
+    // Returns true if an entry with key k exists. 
+    bool contains(const LookupKey& k) const;
+
+    // Inserts or replaces a (k,v) pair. 
+    void put(const K& k, const V& v);
+
+    // Inserts or replaces a (k,v) pair, moving the key and the value in. 
+    void put(K&& k, V&& v);
+
+    // Removes the entry with key k. Returns true if there was one. 
+    bool erase(const LookupKey& k);
+
+    // Calls f(entry) for every entry, one shard at a time. Each shard is read-locked while it is visited, so (f) may
+    // not modify this map. Entries added or removed in other shards during the traversal may or may not be seen. 
+    template <typename F>
+    void forEach(F f) const;
+
+protected:
+    typedef HashMap<K, V, H> Map; // The map type of a single shard. 
+
+    // Structure Shard. One lock and the map it protects, padded to its own cache line so that locking one shard
+    // does not invalidate the cache line of its neighbour. 
+    struct alignas(64) Shard {
+        mutable std::shared_mutex lock; // Shared for lookups, exclusive for updates. 
+        mutable Map map;                // HashMap::find() is not const, but does not modify the map. 
+    };
+
+    // Utility function returning the shard responsible for key (k). 
+    Shard& shardOf(const LookupKey& k) const;
+
+private:
+    H hash;                          // The hash function object used to pick a shard. 
+    int shardBits;                   // log2 of the number of shards. 
+    std::unique_ptr<Shard[]> shards; // The shard array. 
+};
+
+// Member template definitions. 
+// forEach() takes an arbitrary function object, so it is defined here where callers can see it. 
+
+// forEach() function implementation: 
+// Visits the shards in order, holding each shard's lock in shared mode while its entries are passed to (f). 
+template <typename K, typename V, typename H>
+template <typename F>
+void ConcurrentHashMap<K, V, H>::forEach(F f) const {
+    for (int s = 0; s < shardCount(); s++) {
+        std::shared_lock<std::shared_mutex> guard(shards[s].lock); // Readers of this shard may continue. 
+        Map& m = shards[s].map;
+        for (typename Map::Iterator it = m.begin(); !(it == m.end()); ++it)
+            f(static_cast<const Entry&>(*it));
+    }
+}
@@ -0,0 +1,103 @@
+#pragma once // Ensures this header file is included only once.
+
+#include "hashMap.h" // Includes stringHash, whose function call operator is constexpr.
+
+#include <array>       // Includes std::array, which holds the table.
+#include <cstddef>     // Includes std::size_t.
+#include <cstdint>     // Includes std::uint64_t.
+#include <string_view> // Includes std::string_view, the key type.
+#include <utility>     // Includes std::pair, the type of the initial (key, value) pairs.
+
+// Template class ConstexprHashMap. A fixed hash map from string keys to values of type (V), holding the (N) pairs it
+// is constructed from, for lookup tables that are completely known when the program is compiled. Declared constexpr,
+// the whole table is built by the compiler and stored in the program image: nothing runs at startup, so there is no
+// initialization cost and no static initialization order to worry about, and lookups with constant keys are folded
+// to constants. Lookups with run-time keys work as in any open-addressing table.
+// The table has CAPACITY slots (a power of two, at least twice N) and resolves collisions by linear probing. The
+// longest probe sequence of any key is recorded while the table is built, so a lookup, hit or miss, never looks at
+// more slots than that. The hash function (H) must have a constexpr function call operator, like stringHash; its
+// value is mixed before use, so its low bits need not be well distributed. If a key occurs twice, the later value
+// wins, as with HashMap::put(). Keys are std::string_view: they refer to the strings they were given (normally
+// string literals) and do not copy them.
+// Example (makeConstexprHashMap() counts the pairs):
+//     constexpr auto ports = makeConstexprHashMap<int>({ { "http", 80 }, { "https", 443 }, { "ssh", 22 } });
+//     static_assert(*ports.find("https") == 443);
+template <typename V, std::size_t N, typename H = stringHash>
+class ConstexprHashMap {
+public:
+    // Smallest power of two that is at least 2 * N: the table is at most half full. 
+    static constexpr std::size_t CAPACITY = [] {
+        std::size_t c = 1;
+        while (c < 2 * N) c *= 2;
+        return c;
+    }();
+
+    // Constructor: Builds the table from the (N) (key, value) pairs (items). 
+    constexpr ConstexprHashMap(const std::pair<std::string_view, V> (&items)[N])
+        : keys{}, values{}, used{}, count(0), longest(0) {
+        for (std::size_t i = 0; i < N; i++) {
+            std::size_t s = home(items[i].first);
+            int probe = 0;
+            while (used[s] && keys[s] != items[i].first) { // Skip the slots of other keys. 
+                s = (s + 1) & (CAPACITY - 1);
+                probe++;
+            }
+            if (!used[s]) count++;                         // A new key (otherwise the value is replaced). 
+            keys[s] = items[i].first;
+            values[s] = items[i].second;
+            used[s] = true;
+            if (probe > longest) longest = probe;
+        }
+    }
+
+    // Returns a pointer to the value of key k, or nullptr if the map has no such key. 
+    constexpr const V* find(std::string_view k) const {
+        std::size_t s = home(k);
+        for (int probe = 0; probe <= longest && used[s]; probe++) {
+            if (keys[s] == k) return &values[s];
+            s = (s + 1) & (CAPACITY - 1);
+        }
+        return nullptr;
+    }
+
+    // Returns true if the map has key k. 
+    constexpr bool contains(std::string_view k) const { return find(k) != nullptr; }
+
+    // Returns the value of key k, or (fallback) if the map has no such key. 
+    constexpr V valueOr(std::string_view k, const V& fallback) const {
+        const V* v = find(k);
+        return v != nullptr ? *v : fallback;
+    }
+
+    // Returns the number of distinct keys. 
+    constexpr std::size_t size() const { return count; }
+
+    // Returns the length of the longest probe sequence (0 if every key is in its home slot). 
+    constexpr int maxProbe() const { return longest; }
+
+private:
+    // Returns the slot where the search for key (k) starts: its hash, mixed by the 64-bit finalizer of MurmurHash3, 
+    // reduced to the table size. 
+    static constexpr std::size_t home(std::string_view k) {
+        std::uint64_t x = H()(k);
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdull;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ull;
+        x ^= x >> 33;
+        return std::size_t(x) & (CAPACITY - 1);
+    }
+
+    std::array<std::string_view, CAPACITY> keys; // The key of every slot. 
+    std::array<V, CAPACITY> values;              // The value of every slot. 
+    std::array<bool, CAPACITY> used;             // True for the slots that hold a key. 
+    std::size_t count;                           // The number of distinct keys. 
+    int longest;                                 // The longest probe sequence of any key. 
+};
+
+// Builds a ConstexprHashMap from the (N) pairs (items), deducing N; only the value type (V) (and the hash function
+// type (H), if not stringHash) needs to be given.
+template <typename V, typename H = stringHash, std::size_t N>
+constexpr ConstexprHashMap<V, N, H> makeConstexprHashMap(const std::pair<std::string_view, V> (&items)[N]) {
+    return ConstexprHashMap<V, N, H>(items);
+}
\ No newline at end of file
@@ -0,0 +1,299 @@
+#include "cuckooHashMap.h" // Includes the definition of the CuckooHashMap class.
+
+#include <algorithm> // Includes std::max.
+
+// CuckooHashMap constructor implementation: 
+// Allocates the smallest power-of-two number of buckets (at least 2) holding (capacity) entries under MAX_LOAD. 
+template <typename K, typename V, typename H>
+CuckooHashMap<K, V, H>::CuckooHashMap(int capacity) : stashLimit(STASH_SIZE), rnd(0x9E3779B97F4A7C15ull) {
+    int buckets = 2;
+    while (buckets * SLOTS * MAX_LOAD < capacity) buckets *= 2;
+    B.resize(buckets);
+}
+
+// mix() function implementation: 
+// The 64-bit finalizer of MurmurHash3: every output bit depends on every input bit, so the two bucket indices and 
+// the fingerprint, which use different bits, behave like independent hash functions even for a weak hash.
+template <typename K, typename V, typename H>
+std::uint64_t CuckooHashMap<K, V, H>::mix(std::size_t h) {
+    std::uint64_t x = h;
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdull;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ull;
+    x ^= x >> 33;
+    return x;
+}
+
+// tagOf() function implementation: 
+// Takes the top 16 bits of (m) as the fingerprint; 0 is reserved for free slots. 
+template <typename K, typename V, typename H>
+std::uint16_t CuckooHashMap<K, V, H>::tagOf(std::uint64_t m) {
+    std::uint16_t t = std::uint16_t(m >> 48);
+    return t ? t : 1;
+}
+
+// first() function implementation: 
+// The first bucket is given by the low bits of (m). 
+template <typename K, typename V, typename H>
+std::size_t CuckooHashMap<K, V, H>::first(std::uint64_t m) const { return std::size_t(m) & (B.size() - 1); }
+
+// second() function implementation: 
+// The second bucket is the first one XOR an odd offset taken from bits 32 and up of (m), so it always differs. 
+template <typename K, typename V, typename H>
+std::size_t CuckooHashMap<K, V, H>::second(std::uint64_t m) const {
+    std::size_t mask = B.size() - 1;
+    return (first(m) ^ ((std::size_t(m >> 32) & mask) | 1)) & mask;
+}
+
+// size() function implementation: 
+// Returns the current number of entries, i.e. the length of the entry array S. 
+template <typename K, typename V, typename H>
+int CuckooHashMap<K, V, H>::size() const { return int(S.size()); }
+
+// empty() function implementation: 
+// Checks if the map is empty. 
+template <typename K, typename V, typename H>
+bool CuckooHashMap<K, V, H>::empty() const { return size() == 0; }
+
+// bucketCount() function implementation: 
+// Returns the number of buckets in the bucket array B. 
+template <typename K, typename V, typename H>
+int CuckooHashMap<K, V, H>::bucketCount() const { return int(B.size()); }
+
+// loadFactor() function implementation: 
+// Returns the fraction of slots in use. 
+template <typename K, typename V, typename H>
+float CuckooHashMap<K, V, H>::loadFactor() const { return float(size()) / (B.size() * SLOTS); }
+
+// reserve() function implementation: 
+// Grows the entry array and, if needed, the bucket array so that (count) entries fit under MAX_LOAD. 
+template <typename K, typename V, typename H>
+void CuckooHashMap<K, V, H>::reserve(int count) {
+    if (count > 0) reserveSlots(count);
+    int buckets = int(B.size());
+    while (buckets * SLOTS * MAX_LOAD < count) buckets *= 2;
+    if (buckets > int(B.size())) rebuild(buckets);
+}
+
+// reserveSlots() function implementation: 
+// Reallocates S with room for (count) entries; std::vector moves the entries. 
+template <typename K, typename V, typename H>
+void CuckooHashMap<K, V, H>::reserveSlots(std::size_t count) { S.reserve(count); }
+
+// finder() function implementation: 
+// Examines the SLOTS slots of both candidate buckets of mixed hash (m). Only slots whose fingerprint matches have 
+// their entry read, and only entries whose full cached hash matches have their key compared. The stash, normally 
+// empty, is searched last.
+template <typename K, typename V, typename H>
+int CuckooHashMap<K, V, H>::finder(const LookupKey& k, std::uint64_t m) const {
+    std::uint16_t t = tagOf(m);
+    std::size_t b[2] = { first(m), second(m) };
+    prefetchRead(&B[b[1]]);               // Let the second bucket load while the first one is searched. 
+    for (int i = 0; i < 2; i++) {
+        const Bucket& bkt = B[b[i]];
+        for (int s = 0; s < SLOTS; s++) {
+            if (bkt.tag[s] != t) continue;
+            const Slot& e = S[bkt.ent[s]];
+            if (e.hash == m && e.entry.key() == k) return bkt.ent[s];
+        }
+    }
+    for (int e : stash)
+        if (S[e].hash == m && S[e].entry.key() == k) return e;
+    return -1;
+}
+
+// tryPlace() function implementation: 
+// Puts entry (e) into the first free slot of bucket (b), if there is one. 
+template <typename K, typename V, typename H>
+bool CuckooHashMap<K, V, H>::tryPlace(std::size_t b, int e) {
+    Bucket& bkt = B[b];
+    for (int s = 0; s < SLOTS; s++) {
+        if (bkt.tag[s] == 0) {
+            bkt.tag[s] = tagOf(S[e].hash);
+            bkt.ent[s] = e;
+            return true;
+        }
+    }
+    return false;
+}
+
+// place() function implementation: 
+// Puts entry (e) into one of its buckets. If both are full, a random resident of one of them is replaced by (e) 
+// and becomes the entry to place, in its other bucket. Returns -1 once every entry has a slot, or, after MAX_KICKS 
+// moves without a free slot, the entry that is homeless at that point (not necessarily (e)), which is in no bucket.
+template <typename K, typename V, typename H>
+int CuckooHashMap<K, V, H>::place(int e) {
+    for (int kick = 0; kick < MAX_KICKS; kick++) {
+        std::uint64_t m = S[e].hash;
+        std::size_t b1 = first(m), b2 = second(m);
+        if (tryPlace(b1, e) || tryPlace(b2, e)) return -1;
+        rnd ^= rnd << 13;                 // xorshift64: picks the bucket and the slot to evict from. 
+        rnd ^= rnd >> 7;
+        rnd ^= rnd << 17;
+        Bucket& bkt = B[(rnd & 1) ? b1 : b2];
+        int s = int((rnd >> 1) % SLOTS);
+        std::swap(e, bkt.ent[s]);         // (e) takes the slot; the evicted entry is placed next. 
+        bkt.tag[s] = tagOf(S[bkt.ent[s]].hash);
+    }
+    return e;
+}
+
+// rebuild() function implementation: 
+// Clears a bucket array of (buckets) buckets and places every entry again, stashing the homeless ones. If the stash 
+// is still over STASH_SIZE the count is doubled and the entries placed again, at most MAX_REBUILDS times in all, and
+// only while doubling makes the stash smaller: entries with equal hash values stay homeless at any size. The next
+// rebuild happens when the stash has doubled, so such entries cost a logarithmic number of rebuilds, not one each.
+template <typename K, typename V, typename H>
+void CuckooHashMap<K, V, H>::rebuild(int buckets) {
+    std::size_t before = S.size() + 1;   // Stash size of the previous attempt. 
+    for (int attempt = 1;; attempt++) {
+        BktArray NB(buckets);
+        B.swap(NB);
+        stash.clear();
+        for (int i = 0; i < size(); i++) {
+            int e = place(i);
+            if (e >= 0) stash.push_back(e);
+        }
+        if (stash.size() <= std::size_t(STASH_SIZE) || attempt == MAX_REBUILDS || stash.size() >= before) break;
+        before = stash.size();
+        buckets *= 2;
+    }
+    stashLimit = std::max(std::size_t(STASH_SIZE), 2 * stash.size());
+}
+
+// adopt() function implementation: 
+// Places the entry just appended to S, doubling the bucket array first if the map would exceed MAX_LOAD. An entry 
+// left homeless goes to the stash; if that makes the stash too large, the table is rebuilt, first at its own size.
+template <typename K, typename V, typename H>
+typename CuckooHashMap<K, V, H>::Iterator CuckooHashMap<K, V, H>::adopt() {
+    int i = size() - 1;
+    if (size() > B.size() * SLOTS * MAX_LOAD) {
+        rebuild(int(B.size()) * 2);
+    } else {
+        int e = place(i);
+        if (e >= 0) stash.push_back(e);
+        if (stash.size() > stashLimit) rebuild(int(B.size()));
+    }
+    return Iterator(S, i);
+}
+
+// unstash() function implementation: 
+// Replaces entry (e) in the stash by entry (to), or removes it from the stash if (to) is negative. 
+template <typename K, typename V, typename H>
+void CuckooHashMap<K, V, H>::unstash(int e, int to) {
+    for (std::size_t j = 0; j < stash.size(); j++) {
+        if (stash[j] != e) continue;
+        if (to >= 0) stash[j] = to;
+        else {
+            stash[j] = stash.back();
+            stash.pop_back();
+        }
+        return;
+    }
+}
+
+// find() function implementation: 
+// Finds the entry for the given key (k) and returns an iterator to it, or end(). 
+template <typename K, typename V, typename H>
+typename CuckooHashMap<K, V, H>::Iterator CuckooHashMap<K, V, H>::find(const LookupKey& k) {
+    int i = finder(k, mix(hash(k)));
+    return i < 0 ? end() : Iterator(S, i);
+}
+
+// put() function implementation: 
+// Inserts a (k, v) pair, or replaces the value if key (k) already exists. 
+template <typename K, typename V, typename H>
+typename CuckooHashMap<K, V, H>::Iterator CuckooHashMap<K, V, H>::put(const K& k, const V& v) {
+    std::uint64_t m = mix(hash(k));
+    int i = finder(k, m);
+    if (i >= 0) {
+        S[i].entry.setValue(v);
+        return Iterator(S, i);
+    }
+    append(m, std::in_place, k, v);
+    return adopt();
+}
+
+// put(K&&, V&&) function implementation: 
+// Same as put() above, but moves the key and the value into the map. 
+template <typename K, typename V, typename H>
+typename CuckooHashMap<K, V, H>::Iterator CuckooHashMap<K, V, H>::put(K&& k, V&& v) {
+    std::uint64_t m = mix(hash(k));
+    int i = finder(k, m);
+    if (i >= 0) {
+        S[i].entry.setValue(std::move(v));
+        return Iterator(S, i);
+    }
+    append(m, std::in_place, std::move(k), std::move(v));
+    return adopt();
+}
+
+// locate() function implementation: 
+// Finds the bucket (b) and the slot (s) holding entry (e), which can only be in one of its two buckets. Returns 
+// false, leaving (b) and (s) unchanged, if neither holds it.
+template <typename K, typename V, typename H>
+bool CuckooHashMap<K, V, H>::locate(int e, std::size_t& b, int& s) const {
+    std::size_t cand[2] = { first(S[e].hash), second(S[e].hash) };
+    for (int i = 0; i < 2; i++) {
+        for (int j = 0; j < SLOTS; j++) {
+            if (B[cand[i]].tag[j] != 0 && B[cand[i]].ent[j] == e) {
+                b = cand[i];
+                s = j;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// eraser() function implementation: 
+// Frees the slot of entry (i), then moves the last entry into position i of S and updates its slot. An entry that 
+// no bucket holds is in the stash, where it is removed or renumbered instead.
+template <typename K, typename V, typename H>
+void CuckooHashMap<K, V, H>::eraser(int i) {
+    std::size_t b = 0;
+    int s = 0;
+    if (locate(i, b, s)) {               // Free the slot of entry (i). 
+        B[b].tag[s] = 0;
+        B[b].ent[s] = -1;
+    } else {
+        unstash(i, -1);
+    }
+    int last = size() - 1;
+    if (i != last) {
+        if (locate(last, b, s))
+            B[b].ent[s] = i;             // The last entry's slot now refers to position i, 
+        else
+            unstash(last, i);            // or its stash entry does, 
+        S[i] = std::move(S[last]);       // where the entry is moved. 
+    }
+    S.pop_back();
+}
+
+// erase(const LookupKey&) function implementation: 
+// Deletes the entry with key (k), if there is one. 
+template <typename K, typename V, typename H>
+void CuckooHashMap<K, V, H>::erase(const LookupKey& k) {
+    int i = finder(k, mix(hash(k)));
+    if (i >= 0) eraser(i);
+}
+
+// erase(const Iterator&) function implementation: 
+// Deletes the entry pointed to by iterator (p). 
+template <typename K, typename V, typename H>
+void CuckooHashMap<K, V, H>::erase(const Iterator& p) { eraser(p.idx); }
+
+// begin() function implementation: 
+// Returns an iterator to the first entry of the entry array. 
+template <typename K, typename V, typename H>
+typename CuckooHashMap<K, V, H>::Iterator CuckooHashMap<K, V, H>::begin() { return Iterator(S, 0); }
+
+// end() function implementation: 
+// Returns an iterator just past the last entry of the entry array. 
+template <typename K, typename V, typename H>
+typename CuckooHashMap<K, V, H>::Iterator CuckooHashMap<K, V, H>::end() { return Iterator(S, size()); }
+
+// Explicit instantiation of the CuckooHashMap template for std::string keys and int values.
+template class CuckooHashMap<std::string, int, stringHash>;
+template class CuckooHashMap<std::string, int, fastStringHash>;
\ No newline at end of file
@@ -0,0 +1,155 @@
+#pragma once // Ensures this header file is included only once.
+
+#include "hashMap.h" // Includes Entry, LookupKeyOf, stringHash, fastStringHash and prefetchRead().
+
+#include <cstdint> // Includes std::uint16_t, std::int32_t and std::uint64_t.
+#include <utility> // Includes std::move, std::forward and std::swap.
+#include <vector>  // Includes std::vector, used for the entry array and the bucket array.
+
+// Template class CuckooHashMap. A bucketized cuckoo hash table with the HashMap interface.
+// Every key has exactly two candidate buckets, derived from its hash by two different functions, and every bucket
+// has SLOTS slots, so a lookup never examines more than 2 * SLOTS slots however the keys are distributed: its worst
+// case is constant, not just its average. A bucket fills exactly one 64-byte cache line and keeps a 16-bit fingerprint
+// of each slot's key next to the slot, so a lookup reads at most two bucket lines and then only the entries whose
+// fingerprint (and cached hash) match, which for a miss is almost never and for a hit is almost always exactly one.
+// An insertion into two full buckets moves ("kicks") a resident entry to its other bucket, repeatedly if needed; if
+// no free slot is found within MAX_KICKS moves, the entry left without a slot goes to a small stash, searched only
+// when neither bucket holds the key. A stash larger than its limit makes the table rebuild itself, doubling the bucket
+// array at most MAX_REBUILDS - 1 times. More than 2 * SLOTS keys with exactly the same hash value never fit their two
+// buckets, whatever the table size, so they stay in the stash, and its limit grows with them instead of the table.
+// The entries themselves live in a dense array as in HashMap, so iteration is a sequential sweep and moving an entry
+// between buckets moves only its index.
+template <typename K, typename V, typename H>
+class CuckooHashMap {
+public:
+    typedef ::MapEntry<K, V> Entry; // Defines Entry type to represent a (key,value) pair; its key is read-only. 
+    typedef typename LookupKeyOf<K, H>::type LookupKey; // Type accepted by find() and erase(k). 
+
+    // Declaration of the inner Iterator class for CuckooHashMap. 
+    class Iterator;
+
+public:
+    // Constructor: Makes room for at least (capacity) entries. Default is 100. 
+    CuckooHashMap(int capacity = 100);
+
+    // Returns the number of entries (key-value pairs) currently stored in the hash map. 
+    int size() const;
+
+    // Returns true if the map is empty. 
+    bool empty() const;
+
+    // Returns the number of buckets in the bucket array (each holds SLOTS entries). 
+    int bucketCount() const;
+
+    // Returns the current load factor, i.e. the fraction of slots holding an entry. 
+    float loadFactor() const;
+
+    // Makes room for at least (count) entries without growing again. 
+    void reserve(int count);
+
+    // Finds an entry with key k and returns an iterator to it. 
+    Iterator find(const LookupKey& k);
+
+    // Inserts or replaces a (k,v) pair in the map. 
+    Iterator put(const K& k, const V& v);
+
+    // Inserts or replaces a (k,v) pair in the map, moving the key and the value in instead of copying them. 
+    Iterator put(K&& k, V&& v);
+
+    // Removes an entry with key k. 
+    void erase(const LookupKey& k);
+
+    // Erases the entry at position p. As in HashMap, the last entry is moved into position p. 
+    void erase(const Iterator& p);
+
+    // Returns an iterator to the first entry in the map. 
+    Iterator begin();
+
+    // Returns an iterator to the end entry (past-the-end) of the map. 
+    Iterator end();
+
+    static constexpr int SLOTS = 8;        // Slots per bucket. 
+    static constexpr int MAX_KICKS = 256;  // Moves tried by an insertion before the homeless entry is stashed. 
+    static constexpr int STASH_SIZE = 8;   // Stashed entries tolerated before the table is rebuilt. 
+    static constexpr int MAX_REBUILDS = 3; // Bucket array sizes tried by one rebuild. 
+
+protected:
+    // An element of the entry array: the entry and the mixed hash of its key, from which its buckets and its 
+    // fingerprint are derived. 
+    struct Slot {
+        template <typename... Args>
+        Slot(std::uint64_t h, Args&&... args) : entry(std::forward<Args>(args)...), hash(h) { }
+
+        Entry entry;        // The (key,value) pair. 
+        std::uint64_t hash; // mix() of the hash value of entry.key(). 
+    };
+
+    // A bucket: the fingerprint (0 if the slot is free) and the entry index of each of its slots, in one cache line. 
+    struct alignas(64) Bucket {
+        std::uint16_t tag[SLOTS]; // Fingerprint of the key in every slot; 0 marks a free slot. 
+        std::int32_t ent[SLOTS];  // Index in the entry array of the entry in every slot. 
+
+        Bucket() { for (int s = 0; s < SLOTS; s++) { tag[s] = 0; ent[s] = -1; } }
+    };
+
+    typedef std::vector<Slot> SlotArray; // Defines 'SlotArray' as the dense array holding the entries. 
+    typedef std::vector<Bucket> BktArray; // Defines 'BktArray' as the array of buckets. 
+
+    // Utility functions for CuckooHashMap operations. 
+    static std::uint64_t mix(std::size_t h);           // Spreads the bits of a hash value (h) over 64 bits. 
+    static std::uint16_t tagOf(std::uint64_t m);        // Fingerprint of mixed hash (m), never 0. 
+    std::size_t first(std::uint64_t m) const;           // First candidate bucket of mixed hash (m). 
+    std::size_t second(std::uint64_t m) const;          // Second candidate bucket of mixed hash (m), never the first. 
+    int finder(const LookupKey& k, std::uint64_t m) const; // Internal utility function returning the index of key (k), or -1. 
+    bool tryPlace(std::size_t b, int e);                // Internal utility function putting entry (e) into a free slot of bucket (b). 
+    int place(int e);                                   // Internal utility function putting entry (e) into the table, kicking if needed. 
+    void rebuild(int buckets);                          // Internal utility function placing every entry into (at least) (buckets) buckets. 
+    void unstash(int e, int to);                        // Internal utility function replacing entry (e) in the stash by (to), or removing it. 
+    Iterator adopt();                                   // Internal utility function placing the entry just appended to S. 
+    void reserveSlots(std::size_t count);               // Internal utility function growing the capacity of S. 
+    template <typename... Args>
+    void append(Args&&... args);                        // Internal utility function constructing a slot from (args) at the end of S. 
+    bool locate(int e, std::size_t& b, int& s) const;   // Internal utility function finding the bucket (b) and slot (s) holding entry (e). 
+    void eraser(int i);                                 // Internal utility function to remove entry (i). 
+
+    static constexpr float MAX_LOAD = 0.9f; // Fraction of slots that may be used before the bucket array is doubled. 
+
+private:
+    H hash;              // The hash function object. 
+    SlotArray S;         // The entry array, without gaps. 
+    BktArray B;          // The bucket array; its size is a power of two. 
+    std::vector<int> stash; // Entries that are in no bucket. 
+    std::size_t stashLimit; // Stash size above which the next insertion rebuilds the table. 
+    std::uint64_t rnd;   // State of the generator choosing which entry to kick. 
+
+public:
+    // Definition of the CuckooHashMap::Iterator class. 
+    class Iterator {
+    private:
+        int idx;        // The position of the entry within the entry array. 
+        SlotArray* sa;  // A pointer to the entry array this iterator belongs to. 
+
+    public:
+        // Iterator constructor: Initializes the iterator with the entry array (a) and a position (i) in it. 
+        Iterator(SlotArray& a, int i) : idx(i), sa(&a) { }
+
+        // Overloads the dereference operator to return a reference to the Entry pointed to by the iterator. 
+        Entry& operator*() const { return (*sa)[idx].entry; }
+        // Overloads the equality operator to compare if two Iterator objects point to the same location. 
+        bool operator==(const Iterator& p) const { return sa == p.sa && idx == p.idx; }
+        // Overloads the pre-increment operator to advance the iterator to the next entry. 
+        Iterator& operator++() { ++idx; return *this; }
+
+        friend class CuckooHashMap; // Grants the CuckooHashMap class access to the private members of Iterator. 
+    };
+};
+
+// Member template definitions.
+
+// append() function implementation: 
+// Constructs a slot from (args) at the end of S; as in HashMap::append(), a full S moves its entries when it grows.
+template <typename K, typename V, typename H>
+template <typename... Args>
+void CuckooHashMap<K, V, H>::append(Args&&... args) {
+    S.emplace_back(std::forward<Args>(args)...);
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+#include "epoch.h" // Includes the definition of the EpochDomain class.
+
+#include <cstddef> // Includes std::size_t.
+
+// Structure ThreadSlot. Claims a slot of a domain for the calling thread on first use and releases it when the
+// thread exits, so a fixed number of slots serves any number of short-lived threads. 
+struct ThreadSlot {
+    EpochDomain* domain; // The domain the slot belongs to (only the global domain exists). 
+    int index;           // The claimed slot, or -1. 
+    int overflowDepth;   // Number of enter() calls not yet matched by exit() made while the thread had no slot. 
+    ThreadSlot() : domain(nullptr), index(-1), overflowDepth(0) { }
+    ~ThreadSlot() {
+        if (index < 0) return;
+        domain->slots[index].depth = 0;
+        domain->slots[index].active.store(0, std::memory_order_seq_cst);   // The thread can no longer be reading, 
+        domain->slots[index].used.store(false, std::memory_order_release); // and the slot is free for another thread. 
+    }
+};
+
+static thread_local ThreadSlot mine; // The calling thread's slot, released automatically when the thread exits. 
+
+// EpochDomain constructor implementation: 
+// Starts at epoch 1 with every slot free and no overflow reader. 
+EpochDomain::EpochDomain() : epoch(1), overflow(0) {
+    for (int i = 0; i < MAX_THREADS; i++) {
+        slots[i].active.store(0);
+        slots[i].used.store(false);
+        slots[i].depth = 0;
+    }
+}
+
+// global() function implementation: 
+// Returns the process-wide domain, created on first use. 
+EpochDomain& EpochDomain::global() {
+    static EpochDomain domain;
+    return domain;
+}
+
+// slotOfThisThread() function implementation: 
+// Returns the calling thread's slot, claiming a free one with a compare-and-swap the first time. If all MAX_THREADS 
+// slots are taken it returns -1 after one pass instead of waiting, and the caller reads through the overflow counter. 
+// A thread without a slot tries again on its next outermost enter(), so it gets one once another thread exits.
+int EpochDomain::slotOfThisThread() {
+    if (mine.index >= 0) return mine.index;
+    if (mine.overflowDepth > 0) return -1; // Inside an overflow read: exit() must find the same state. 
+    for (int i = 0; i < MAX_THREADS; i++) {
+        bool expected = false;
+        if (slots[i].used.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+            mine.domain = this;
+            mine.index = i;
+            return i;
+        }
+    }
+    return -1; // More than MAX_THREADS threads use the domain at the same time. 
+}
+
+// enter() function implementation: 
+// Announces the current global epoch. The store is sequentially consistent, so it is visible to writers before any
+// pointer the reader loads afterwards. A nested call only counts: announcing a newer epoch would drop the protection 
+// of the pointers the outer read has already loaded. A thread without a slot increments the overflow counter instead, 
+// which keeps every writer from advancing the epoch until it is back to zero.
+void EpochDomain::enter() {
+    int i = slotOfThisThread();
+    if (i < 0) {
+        if (mine.overflowDepth++ > 0) return;
+        overflow.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst); // Keep the reader's loads after its announcement. 
+        return;
+    }
+    Slot& s = slots[i];
+    if (s.depth++ > 0) return;
+    s.active.store(epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst); // Keep the reader's loads after its announcement. 
+}
+
+// exit() function implementation: 
+// Withdraws the announcement (or the overflow count) when the outermost read ends; the reader holds no pointers any more. 
+void EpochDomain::exit() {
+    if (mine.index < 0) {
+        if (--mine.overflowDepth == 0) overflow.fetch_sub(1, std::memory_order_release);
+        return;
+    }
+    Slot& s = slots[mine.index];
+    if (--s.depth > 0) return;
+    s.active.store(0, std::memory_order_release);
+}
+
+// tryAdvance() function implementation: 
+// Moves the global epoch from e to e+1 if no active reader is still in an older epoch. A reader counted in the 
+// overflow counter may be in any epoch, so the epoch does not move while that counter is non-zero.
+std::uint64_t EpochDomain::tryAdvance() {
+    std::atomic_thread_fence(std::memory_order_seq_cst); // Order the caller's unlinking stores before the slot scan. 
+    std::uint64_t e = epoch.load(std::memory_order_seq_cst);
+    if (overflow.load(std::memory_order_seq_cst) != 0) return e;
+    for (int i = 0; i < MAX_THREADS; i++) {
+        std::uint64_t a = slots[i].active.load(std::memory_order_seq_cst);
+        if (a != 0 && a != e) return e; // A reader is still in an older epoch; try again later. 
+    }
+    epoch.compare_exchange_strong(e, e + 1, std::memory_order_seq_cst); // Another writer may have advanced it already. 
+    return epoch.load(std::memory_order_seq_cst);
+}
+
+// RetireList destructor implementation: 
+// Frees every pending object; the owning structure is being destroyed, so there are no readers left. 
+RetireList::~RetireList() {
+    for (std::size_t i = 0; i < items.size(); i++)
+        items[i].deleter(items[i].p);
+}
+
+// retire() function implementation: 
+// Records (p) with the current epoch. It is freed by a later reclaim() once the epoch has advanced twice. 
+void RetireList::retire(void* p, void (*deleter)(void*)) {
+    Retired r = { p, deleter, domain.current() };
+    items.push_back(r);
+}
+
+// reclaim() function implementation: 
+// Tries to advance the epoch, then frees the oldest objects while they are safe. 
+void RetireList::reclaim() {
+    domain.tryAdvance();
+    std::size_t done = 0;
+    while (done < items.size() && domain.isSafe(items[done].epoch)) { // Items are in epoch order. 
+        items[done].deleter(items[done].p);
+        done++;
+    }
+    items.erase(items.begin(), items.begin() + done);
+}
@@ -0,0 +1,90 @@
+#pragma once // Ensures this header file is included only once.
+
+#include <atomic>  // Includes std::atomic, which every epoch counter is.
+#include <cstdint> // Includes std::uint64_t.
+#include <vector>  // Includes std::vector, which holds retired objects.
+
+// Class EpochDomain. Epoch-based memory reclamation: lets a writer unlink an object that lock-free readers may still
+// be looking at, and free it only once every reader that could have seen it has finished.
+// A reader announces the global epoch in its slot for the duration of a read (see EpochGuard). The global epoch can
+// only advance when every active reader has announced the current one, so once it has advanced twice past the epoch
+// an object was retired in, no reader can still hold a pointer to it.
+// Readers never wait for anything; only writers (which call retire() and reclaim()) do the bookkeeping. A thread that
+// finds every slot taken reads through a shared overflow counter instead, which holds the epoch back while it is
+// non-zero; reclamation is then delayed, but the reader is not.
+class EpochDomain {
+public:
+    static const int MAX_THREADS = 256; // Number of threads that can be registered at the same time; more share the overflow counter. 
+
+    // Returns the process-wide domain shared by all lock-free containers. 
+    static EpochDomain& global();
+
+    // Marks the calling thread as reading; pointers loaded after this call stay valid until exit(). 
+    // Calls nest: only the outermost enter() announces an epoch, and only the matching exit() withdraws it. 
+    void enter();
+    // Marks the calling thread as no longer reading, once every enter() has been matched. 
+    void exit();
+
+    // Returns the current global epoch. 
+    std::uint64_t current() const { return epoch.load(std::memory_order_seq_cst); }
+    // Advances the global epoch if every active reader has announced the current one. Returns the (new) epoch. 
+    std::uint64_t tryAdvance();
+    // Returns true if memory retired at epoch (e) can no longer be reached by any reader. 
+    bool isSafe(std::uint64_t e) const { return current() >= e + 2; }
+
+private:
+    // Structure Slot. The announced epoch of one thread (0 = not reading), on its own cache line. 
+    struct alignas(64) Slot {
+        std::atomic<std::uint64_t> active; // Epoch announced by the owning thread, or 0. 
+        std::atomic<bool> used;            // True while a thread owns the slot. 
+        int depth;                         // Number of enter() calls not yet matched by exit() (owning thread only). 
+    };
+
+    EpochDomain();
+    int slotOfThisThread();  // Returns (registering on first use) the calling thread's slot, or -1 if none is free. 
+
+    std::atomic<std::uint64_t> epoch;     // The global epoch. Starts at 1, so 0 can mean "not reading". 
+    Slot slots[MAX_THREADS];              // One slot per registered thread. 
+    alignas(64) std::atomic<int> overflow; // Number of threads without a slot that are reading. 
+
+    friend struct ThreadSlot;
+};
+
+// Class EpochGuard. Keeps the calling thread inside a read-side critical section of a domain for its lifetime. 
+class EpochGuard {
+public:
+    explicit EpochGuard(EpochDomain& d) : domain(d) { domain.enter(); }
+    ~EpochGuard() { domain.exit(); }
+
+private:
+    EpochDomain& domain;
+    EpochGuard(const EpochGuard&);            // A guard is tied to one scope. 
+    EpochGuard& operator=(const EpochGuard&);
+};
+
+// Class RetireList. Objects unlinked by a writer, waiting until no reader can reach them.
+// Not thread-safe by itself: it belongs to one data structure and is used under that structure's writer lock. 
+class RetireList {
+public:
+    explicit RetireList(EpochDomain& d) : domain(d) { }
+    // Frees every object that is still pending. Only valid once no reader can access the owning structure. 
+    ~RetireList();
+
+    // Schedules (p) to be released by calling deleter(p) once it is safe. 
+    void retire(void* p, void (*deleter)(void*));
+    // Advances the epoch if possible and frees every object that has become safe. 
+    void reclaim();
+    // Returns the number of objects still waiting to be freed. 
+    int pending() const { return int(items.size()); }
+
+private:
+    // Structure Retired. One unlinked object and the epoch it was retired in. 
+    struct Retired {
+        void* p;
+        void (*deleter)(void*);
+        std::uint64_t epoch;
+    };
+
+    EpochDomain& domain;          // The domain whose readers may still see the objects. 
+    std::vector<Retired> items;   // Objects waiting to be freed, oldest first. 
+};
@@ -0,0 +1,251 @@
+#include "flatHashMap.h" // Includes the definition of the FlatHashMap class.
+
+#include <memory>  // Includes std::allocator, used to obtain raw slot storage.
+#include <new>     // Includes placement new.
+#include <utility> // Includes std::swap.
+
+// slotsFor() function implementation: 
+// Returns the smallest power of two (at least GROUP_WIDTH) whose 7/8 can hold (count) entries. 
+template <typename K, typename V, typename H>
+int FlatHashMap<K, V, H>::slotsFor(int count) {
+    int slots = GROUP_WIDTH;                                  // The table always holds at least one group. 
+    while ((long long)slots * MAX_LOAD_NUM / MAX_LOAD_DEN < count) // Double until (count) entries fit under the load limit. 
+        slots *= 2;
+    return slots;
+}
+
+// FlatHashMap constructor implementation: 
+// Allocates an all-EMPTY table large enough for (capacity) entries. 
+template <typename K, typename V, typename H>
+FlatHashMap<K, V, H>::FlatHashMap(int capacity) : n(0), growthLeft(0), slots(nullptr) {
+    int count = slotsFor(capacity);                     // Number of slots to allocate. 
+    ctrl.assign(count, EMPTY);                          // Every slot starts out EMPTY. 
+    slots = std::allocator<Entry>().allocate(count);    // Raw storage; entries are constructed on insertion. 
+    growthLeft = count / MAX_LOAD_DEN * MAX_LOAD_NUM;   // Number of EMPTY slots usable before growing. 
+}
+
+// Copy constructor implementation: 
+// Copies the control bytes and copy-constructs every live entry into the same slot. 
+template <typename K, typename V, typename H>
+FlatHashMap<K, V, H>::FlatHashMap(const FlatHashMap& other)
+    : n(other.n), growthLeft(other.growthLeft), hash(other.hash), ctrl(other.ctrl), slots(nullptr) {
+    slots = std::allocator<Entry>().allocate(ctrl.size());  // Same number of slots as (other). 
+    for (int i = 0; i < bucketCount(); i++)                 // Copy every live entry. 
+        if (ctrl[i] >= 0) new (&slots[i]) Entry(other.slots[i]);
+}
+
+// Copy assignment implementation: 
+// Copies (other) into a temporary and swaps it in, so this map is unchanged if copying fails. 
+template <typename K, typename V, typename H>
+FlatHashMap<K, V, H>& FlatHashMap<K, V, H>::operator=(const FlatHashMap& other) {
+    if (this == &other) return *this; // Self-assignment is a no-op. 
+    FlatHashMap tmp(other);           // Copy of (other). 
+    std::swap(n, tmp.n);              // Exchange the contents; tmp releases the old ones. 
+    std::swap(growthLeft, tmp.growthLeft);
+    std::swap(hash, tmp.hash);
+    ctrl.swap(tmp.ctrl);
+    std::swap(slots, tmp.slots);
+    return *this;
+}
+
+// Destructor implementation: 
+// Destroys every entry and releases the slot array. 
+template <typename K, typename V, typename H>
+FlatHashMap<K, V, H>::~FlatHashMap() { destroyAll(); }
+
+// destroyAll() function implementation: 
+// Runs the destructor of every live entry and returns the slot storage. 
+template <typename K, typename V, typename H>
+void FlatHashMap<K, V, H>::destroyAll() {
+    if (slots == nullptr) return;           // Nothing to release (e.g. after a swap). 
+    for (int i = 0; i < bucketCount(); i++) // Destroy every live entry. 
+        if (ctrl[i] >= 0) slots[i].~Entry();
+    std::allocator<Entry>().deallocate(slots, ctrl.size()); // Return the raw storage. 
+    slots = nullptr;
+}
+
+// size() function implementation: 
+// Returns the current number of entries (n). 
+template <typename K, typename V, typename H>
+int FlatHashMap<K, V, H>::size() const { return n; }
+
+// empty() function implementation: 
+// Checks if the map is empty (i.e., if the number of entries is 0). 
+template <typename K, typename V, typename H>
+bool FlatHashMap<K, V, H>::empty() const { return size() == 0; }
+
+// bucketCount() function implementation: 
+// Returns the number of slots in the table. 
+template <typename K, typename V, typename H>
+int FlatHashMap<K, V, H>::bucketCount() const { return ctrl.size(); }
+
+// loadFactor() function implementation: 
+// Returns the fraction of slots holding an entry. 
+template <typename K, typename V, typename H>
+float FlatHashMap<K, V, H>::loadFactor() const { return float(n) / bucketCount(); }
+
+// reserve() function implementation: 
+// Grows the table so that (count) entries fit without another resize. 
+template <typename K, typename V, typename H>
+void FlatHashMap<K, V, H>::reserve(int count) {
+    int need = slotsFor(count);   // Number of slots required for (count) entries. 
+    if (need > bucketCount())     // Only ever grow; reserve() never shrinks the table. 
+        resize(need);
+}
+
+// rehash() function implementation: 
+// Rebuilds the table with at least (buckets) slots (rounded up to a power of two). 
+template <typename K, typename V, typename H>
+void FlatHashMap<K, V, H>::rehash(int buckets) {
+    int need = slotsFor(n);          // Never rebuild into a table that is too small for the current entries. 
+    int want = GROUP_WIDTH;          // Round the request up to a power of two. 
+    while (want < buckets) want *= 2;
+    resize(want > need ? want : need);
+}
+
+// resize() function implementation: 
+// Allocates a new table with (count) slots and moves every entry into it. DELETED markers are dropped. 
+template <typename K, typename V, typename H>
+void FlatHashMap<K, V, H>::resize(int count) {
+    std::vector<Ctrl> oldCtrl(count, EMPTY);   // The new control bytes (swapped in below). 
+    Entry* oldSlots = std::allocator<Entry>().allocate(count); // The new slot storage. 
+    ctrl.swap(oldCtrl);                        // From here on (ctrl, slots) describe the new table, 
+    std::swap(slots, oldSlots);                // and (oldCtrl, oldSlots) the old one. 
+    growthLeft = count / MAX_LOAD_DEN * MAX_LOAD_NUM;
+    for (std::size_t i = 0; i < oldCtrl.size(); i++) { // Move every live entry into the new table. 
+        if (oldCtrl[i] < 0) continue;                   // Skip EMPTY and DELETED slots. 
+        std::size_t h = mix(hash(oldSlots[i].key()));   // Hash of the entry's key. 
+        int j = findFree(h);                            // The new table has no duplicates, so take the first free slot. 
+        new (&slots[j]) Entry(std::move(oldSlots[i]));  // Move the entry into its new slot, 
+        oldSlots[i].~Entry();                           // and destroy the moved-from one. 
+        ctrl[j] = h2(h);
+        growthLeft--;
+    }
+    std::allocator<Entry>().deallocate(oldSlots, oldCtrl.size()); // Release the old storage. 
+}
+
+// Iterator::operator++() implementation: 
+// Advances the iterator to the next slot holding an entry (or to end()). 
+template <typename K, typename V, typename H>
+typename FlatHashMap<K, V, H>::Iterator& FlatHashMap<K, V, H>::Iterator::operator++() {
+    ++i;                                                      // Leave the current slot. 
+    while (i < map->bucketCount() && map->ctrl[i] < 0) ++i;  // Skip EMPTY and DELETED slots. 
+    return *this;
+}
+
+// end() function implementation: 
+// Returns an iterator one past the last slot. 
+template <typename K, typename V, typename H>
+typename FlatHashMap<K, V, H>::Iterator FlatHashMap<K, V, H>::end() {
+    return Iterator(this, bucketCount());
+}
+
+// begin() function implementation: 
+// Returns an iterator to the first slot holding an entry. 
+template <typename K, typename V, typename H>
+typename FlatHashMap<K, V, H>::Iterator FlatHashMap<K, V, H>::begin() {
+    Iterator p(this, -1); // Start just before slot 0, 
+    return ++p;           // and advance to the first live slot. 
+}
+
+// finder() function implementation: 
+// Probes group after group along the probe sequence of (h). Within a group, all control bytes are compared with
+// h2(h) at once and keys are only compared for the matching slots. The search stops at the first group containing
+// an EMPTY slot. 
+template <typename K, typename V, typename H>
+int FlatHashMap<K, V, H>::finder(const LookupKey& k, std::size_t h) const {
+    std::size_t groups = bucketCount() / GROUP_WIDTH; // Number of groups (a power of two). 
+    std::size_t g = h1(h) & (groups - 1);             // First group on the probe sequence. 
+    Ctrl tag = h2(h);                                 // Tag to look for. 
+    for (std::size_t step = 1; step <= groups; step++) {
+        ProbeGroup group(&ctrl[g * GROUP_WIDTH]);     // Control bytes of the current group. 
+        for (unsigned m = group.match(tag); m != 0; m &= m - 1) { // Visit every slot with a matching tag. 
+            int i = g * GROUP_WIDTH + ProbeGroup::lowestBit(m);
+            if (slots[i].key() == k) return i;        // Tag match: confirm with a full key compare. 
+        }
+        if (group.matchEmpty() != 0) return -1;       // An EMPTY slot ends every probe sequence passing through here. 
+        g = (g + step) & (groups - 1);                // Triangular probing visits every group exactly once. 
+    }
+    return -1; // Every group was full and none held the key. 
+}
+
+// findFree() function implementation: 
+// Returns the first EMPTY or DELETED slot on the probe sequence of (h). 
+template <typename K, typename V, typename H>
+int FlatHashMap<K, V, H>::findFree(std::size_t h) const {
+    std::size_t groups = bucketCount() / GROUP_WIDTH; // Number of groups (a power of two). 
+    std::size_t g = h1(h) & (groups - 1);             // First group on the probe sequence. 
+    for (std::size_t step = 1; ; step++) {            // growthLeft guarantees a free slot exists. 
+        unsigned m = ProbeGroup(&ctrl[g * GROUP_WIDTH]).matchFree(); // EMPTY and DELETED slots of the group. 
+        if (m != 0) return g * GROUP_WIDTH + ProbeGroup::lowestBit(m);
+        g = (g + step) & (groups - 1);
+    }
+}
+
+// find() function implementation: 
+// Finds the entry for the given key (k) and returns an iterator to it, or end(). 
+template <typename K, typename V, typename H>
+typename FlatHashMap<K, V, H>::Iterator FlatHashMap<K, V, H>::find(const LookupKey& k) {
+    int i = finder(k, mix(hash(k)));           // Slot of key (k), or -1. 
+    return i < 0 ? end() : Iterator(this, i);
+}
+
+// put() function implementation: 
+// Inserts a (k, v) pair into the map, or replaces the value if key (k) already exists. 
+template <typename K, typename V, typename H>
+typename FlatHashMap<K, V, H>::Iterator FlatHashMap<K, V, H>::put(const K& k, const V& v) {
+    std::size_t h = mix(hash(k));      // Hash key (k) once for both the lookup and the insertion. 
+    int i = finder(k, h);              // Slot of key (k), or -1. 
+    if (i < 0)                         // If key (k) was not found, 
+        return emplacer(h, std::in_place, k, v); // construct a new entry directly in its slot. 
+    slots[i].setValue(v);              // Otherwise replace the value of the existing entry. 
+    return Iterator(this, i);
+}
+
+// put(K&&, V&&) function implementation: 
+// Same as put() above, but moves the key and the value into the map. 
+template <typename K, typename V, typename H>
+typename FlatHashMap<K, V, H>::Iterator FlatHashMap<K, V, H>::put(K&& k, V&& v) {
+    std::size_t h = mix(hash(k));      // Hash key (k) once for both the lookup and the insertion. 
+    int i = finder(k, h);              // Slot of key (k), or -1. 
+    if (i < 0)                         // If key (k) was not found, 
+        return emplacer(h, std::in_place, std::move(k), std::move(v)); // move (k, v) into a new entry. 
+    slots[i].setValue(std::move(v));   // Otherwise move the new value into the existing entry. 
+    return Iterator(this, i);
+}
+
+// eraser() function implementation: 
+// Destroys the entry in slot (i). The slot becomes EMPTY if its group still has an EMPTY slot (then no probe
+// sequence ever continued past this group); otherwise it becomes DELETED so later probes keep going. 
+template <typename K, typename V, typename H>
+void FlatHashMap<K, V, H>::eraser(int i) {
+    slots[i].~Entry();                                        // Destroy the entry. 
+    ProbeGroup group(&ctrl[i / GROUP_WIDTH * GROUP_WIDTH]);   // Control bytes of the slot's group. 
+    if (group.matchEmpty() != 0) {
+        ctrl[i] = EMPTY;   // The slot can be reused freely, 
+        growthLeft++;      // and gives back its growth. 
+    } else {
+        ctrl[i] = DELETED; // Keep probe sequences intact. 
+    }
+    n--; // Decrement the number of entries in the map by 1. 
+}
+
+// erase(const Iterator& p) function implementation: 
+// Deletes the entry pointed to by iterator p. 
+template <typename K, typename V, typename H>
+void FlatHashMap<K, V, H>::erase(const Iterator& p) {
+    eraser(p.i);
+}
+
+// erase(const K& k) function implementation: 
+// Deletes the entry with key (k), if there is one. 
+template <typename K, typename V, typename H>
+void FlatHashMap<K, V, H>::erase(const LookupKey& k) {
+    int i = finder(k, mix(hash(k))); // Slot of key (k), or -1. 
+    if (i < 0) return;                // Like HashMap, erasing a missing key does nothing. 
+    eraser(i);
+}
+
+// Explicit instantiation of the FlatHashMap template for std::string keys, int values, and stringHash. 
+template class FlatHashMap<std::string, int, stringHash>;
+template class FlatHashMap<std::string, int, fastStringHash>;
@@ -0,0 +1,390 @@
+#pragma once // Ensures this header file is included only once.
+
+#include "hashMap.h" // Reuses the Entry class and the stringHash function object of the chained HashMap.
+
+#include <cstddef> // Includes std::size_t.
+#include <new>     // Includes placement new.
+#include <utility> // Includes std::move, std::forward, std::pair and std::in_place.
+#include <vector>  // Includes std::vector, which holds the control bytes.
+
+// The group scan is selected at compile time: AVX2 compares 32 control bytes per instruction, SSE2 compares 16,
+// and other targets fall back to a plain loop over 16 bytes.
+#if defined(__AVX2__)
+#include <immintrin.h> // Includes the AVX2 intrinsics.
+#define FLAT_HASH_MAP_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h> // Includes the SSE2 intrinsics.
+#define FLAT_HASH_MAP_SSE2
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h> // Includes _BitScanForward.
+#endif
+
+// Structure ProbeGroup. Loads the control bytes of one group and turns a comparison against every byte into a
+// bit mask (bit j set = slot j of the group matches), so a probe costs a few instructions instead of one compare per slot.
+struct ProbeGroup {
+#if defined(FLAT_HASH_MAP_AVX2)
+    static constexpr int WIDTH = 32; // Number of control bytes compared at once. 
+
+    // Constructor: Loads WIDTH control bytes starting at (ctrl). 
+    explicit ProbeGroup(const signed char* ctrl) : c(_mm256_loadu_si256((const __m256i*)ctrl)) { }
+
+    // Returns the slots whose control byte equals (tag). 
+    unsigned match(signed char tag) const { return unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi8(c, _mm256_set1_epi8(tag)))); }
+    // Returns the EMPTY slots. 
+    unsigned matchEmpty() const { return match(-128); }
+    // Returns the EMPTY or DELETED slots, i.e. those whose control byte has its sign bit set. 
+    unsigned matchFree() const { return unsigned(_mm256_movemask_epi8(c)); }
+
+private:
+    __m256i c; // The loaded control bytes. 
+#elif defined(FLAT_HASH_MAP_SSE2)
+    static constexpr int WIDTH = 16; // Number of control bytes compared at once. 
+
+    // Constructor: Loads WIDTH control bytes starting at (ctrl). 
+    explicit ProbeGroup(const signed char* ctrl) : c(_mm_loadu_si128((const __m128i*)ctrl)) { }
+
+    // Returns the slots whose control byte equals (tag). 
+    unsigned match(signed char tag) const { return unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(c, _mm_set1_epi8(tag)))); }
+    // Returns the EMPTY slots. 
+    unsigned matchEmpty() const { return match(-128); }
+    // Returns the EMPTY or DELETED slots, i.e. those whose control byte has its sign bit set. 
+    unsigned matchFree() const { return unsigned(_mm_movemask_epi8(c)); }
+
+private:
+    __m128i c; // The loaded control bytes. 
+#else
+    static constexpr int WIDTH = 16; // Number of control bytes compared per group. 
+
+    // Constructor: Remembers where the WIDTH control bytes of the group start. 
+    explicit ProbeGroup(const signed char* ctrl) : c(ctrl) { }
+
+    // Returns the slots whose control byte equals (tag). 
+    unsigned match(signed char tag) const {
+        unsigned mask = 0;
+        for (int j = 0; j < WIDTH; j++)
+            if (c[j] == tag) mask |= 1u << j;
+        return mask;
+    }
+    // Returns the EMPTY slots. 
+    unsigned matchEmpty() const { return match(-128); }
+    // Returns the EMPTY or DELETED slots, i.e. those whose control byte is negative. 
+    unsigned matchFree() const {
+        unsigned mask = 0;
+        for (int j = 0; j < WIDTH; j++)
+            if (c[j] < 0) mask |= 1u << j;
+        return mask;
+    }
+
+private:
+    const signed char* c; // The control bytes of the group. 
+#endif
+
+public:
+    // Returns the index of the lowest set bit of a non-zero (mask). 
+    static int lowestBit(unsigned mask) {
+#if defined(_MSC_VER)
+        unsigned long j;
+        _BitScanForward(&j, mask);
+        return int(j);
+#else
+        return __builtin_ctz(mask);
+#endif
+    }
+};
+
+// Template class FlatHashMap. An open-addressing (SwissTable-style) alternative to HashMap with the same
+// interface, so a program can switch between the two with a typedef.
+// Every slot has a one-byte control tag: EMPTY, DELETED, or the low 7 bits of the hash of the key stored in it.
+// Slots are grouped ProbeGroup::WIDTH at a time; a lookup compares the tags of a whole group at once and only
+// compares keys on a tag match.
+// Entries live in one contiguous array, so put() does not allocate per entry and a probe touches one or two cache lines.
+template <typename K, typename V, typename H>
+class FlatHashMap {
+public:
+    typedef ::MapEntry<K, V> Entry; // Defines Entry type to represent a (key,value) pair; its key is read-only. 
+    typedef typename LookupKeyOf<K, H>::type LookupKey; // Type accepted by find() and erase(k), e.g. std::string_view for stringHash. 
+
+    // Declaration of the inner Iterator class for FlatHashMap. 
+    class Iterator;
+
+public:
+    // Constructor: Makes room for at least (capacity) entries. Default is 16. 
+    FlatHashMap(int capacity = 16);
+    // Copy constructor: Copies every entry of (other). 
+    FlatHashMap(const FlatHashMap& other);
+    // Copy assignment: Replaces the contents of this map with a copy of (other). 
+    FlatHashMap& operator=(const FlatHashMap& other);
+    // Destructor: Destroys every entry and releases the slot array. 
+    ~FlatHashMap();
+
+    // Returns the number of entries (key-value pairs) currently stored in the hash map. 
+    int size() const;
+
+    // Returns true if the map is empty. 
+    bool empty() const;
+
+    // Returns the number of slots in the slot array. 
+    int bucketCount() const;
+
+    // Returns the current load factor, i.e. the fraction of slots holding an entry. 
+    float loadFactor() const;
+
+    // Makes room for at least (count) entries without growing again. 
+    void reserve(int count);
+
+    // Rebuilds the table with (at least) the given number of slots, dropping all DELETED markers. 
+    // Iterators obtained before the call are invalidated. 
+    void rehash(int buckets);
+
+    // Finds an entry with key k and returns an iterator to it. 
+    Iterator find(const LookupKey& k);
+
+    // Inserts or replaces a (k,v) pair in the map. 
+    Iterator put(const K& k, const V& v);
+
+    // Inserts or replaces a (k,v) pair in the map, moving the key and the value in instead of copying them. 
+    Iterator put(K&& k, V&& v);
+
+    // Constructs an entry from (args) (a key followed by the value's constructor arguments) and inserts it unless its
+    // key is already present. The key must exist before the slot can be found, so the entry is built once on the
+    // stack and then moved into its slot. Returns the position of the entry and whether an insertion took place. 
+    template <typename... Args>
+    std::pair<Iterator, bool> emplace(Args&&... args);
+
+    // Inserts an entry with key k whose value is constructed in place from (args), unless key k is already present.
+    // Unlike emplace(), nothing is constructed (and no argument is moved from) if the key exists. 
+    template <typename... Args>
+    std::pair<Iterator, bool> try_emplace(const K& k, Args&&... args);
+    template <typename... Args>
+    std::pair<Iterator, bool> try_emplace(K&& k, Args&&... args);
+
+    // Assigns (v) to the entry with key k, or inserts a new (k,v) entry if key k is absent. 
+    // Returns the position of the entry and whether an insertion took place. 
+    template <typename M>
+    std::pair<Iterator, bool> insert_or_assign(const K& k, M&& v);
+    template <typename M>
+    std::pair<Iterator, bool> insert_or_assign(K&& k, M&& v);
+
+    // Looks up every key in [first, last) and writes its position (or end()) to (out), in order. 
+    // Keys are processed in batches: all keys of a batch are hashed and their control bytes and candidate slots
+    // prefetched before any of them is searched, so the cache misses of different keys overlap. 
+    template <typename KeyIt, typename OutIt>
+    OutIt findMany(KeyIt first, KeyIt last, OutIt out);
+
+    // Inserts or replaces the pairs (*first, *values), (*(first+1), *(values+1)), ... for every key in [first, last).
+    // Room for all of them is reserved up front and the control bytes are prefetched in batches like findMany(). 
+    template <typename KeyIt, typename ValIt>
+    void putMany(KeyIt first, KeyIt last, ValIt values);
+
+    // Removes an entry with key k. 
+    void erase(const LookupKey& k);
+
+    // Erases the entry at position p. 
+    void erase(const Iterator& p);
+
+    // Returns an iterator to the first entry in the map. 
+    Iterator begin();
+
+    // Returns an iterator to the end entry (past-the-end) of the map. 
+    Iterator end();
+
+protected:
+    typedef signed char Ctrl; // Type of a control byte. 
+
+    static constexpr Ctrl EMPTY = -128;    // Control byte of a slot that has never held an entry (0x80). 
+    static constexpr Ctrl DELETED = -2;    // Control byte of a slot whose entry was erased (0xFE). 
+    static constexpr int GROUP_WIDTH = ProbeGroup::WIDTH; // Number of slots whose control bytes are scanned together. 
+    static constexpr int MAX_LOAD_NUM = 7; // The table grows once 7/8 of its slots are used (full or DELETED). 
+    static constexpr int MAX_LOAD_DEN = 8;
+    static constexpr int BATCH = 16;   // Number of keys whose memory accesses findMany() and putMany() overlap. 
+
+    // Scrambles the hash value so that both the group index and the tag get well-mixed bits. 
+    static std::size_t mix(std::size_t h) {
+        unsigned long long x = h * 0x9E3779B97F4A7C15ull; // Multiply by 2^64 / golden ratio. 
+        return std::size_t(x ^ (x >> 32));                 // Fold the high half into the low half. 
+    }
+    static std::size_t h1(std::size_t h) { return h >> 7; }     // Selects the first group to probe. 
+    static Ctrl h2(std::size_t h) { return Ctrl(h & 0x7F); }    // The 7-bit tag stored in the control byte. 
+
+    // Utility functions for FlatHashMap operations. 
+    int finder(const LookupKey& k, std::size_t h) const; // Returns the slot holding key (k) with mixed hash (h), or -1. 
+    int findFree(std::size_t h) const;                 // Returns the first EMPTY or DELETED slot on the probe path of (h). 
+    template <typename... Args>
+    Iterator emplacer(std::size_t h, Args&&... args);  // Constructs an entry whose key is known to be absent from (args). 
+    void eraser(int i);                                // Removes the entry stored in slot (i). 
+    void resize(int slots);                            // Moves every entry into a new table with (slots) slots. 
+    void destroyAll();                                 // Destroys every entry and releases the slot array. 
+    static int slotsFor(int count);                    // Smallest power-of-two slot count holding (count) entries. 
+
+private:
+    int n;                  // The number of entries currently stored in the hash map. 
+    int growthLeft;         // Number of EMPTY slots that may still be filled before the table must grow. 
+    H hash;                 // The hash function object used to hash keys. 
+    std::vector<Ctrl> ctrl; // One control byte per slot. Its size is a power of two and a multiple of GROUP_WIDTH. 
+    Entry* slots;           // Raw storage for the entries. Only slots whose control byte is a tag hold a live Entry. 
+
+public:
+    // Definition of the FlatHashMap::Iterator class. 
+    class Iterator {
+    private:
+        FlatHashMap* map; // The map this iterator belongs to. 
+        int i;            // The slot index of the entry, or bucketCount() for end(). 
+
+    public:
+        // Iterator constructor: Initializes the iterator with the map (m) and the slot index (idx). 
+        Iterator(FlatHashMap* m, int idx) : map(m), i(idx) { }
+
+        // Overloads the dereference operator to return a reference to the Entry pointed to by the iterator. 
+        Entry& operator*() const { return map->slots[i]; }
+        // Overloads the equality operator to compare if two Iterator objects point to the same location. 
+        bool operator==(const Iterator& p) const { return map == p.map && i == p.i; }
+        // Overloads the pre-increment operator to advance the iterator to the next entry. 
+        Iterator& operator++();
+
+        friend class FlatHashMap; // Grants the FlatHashMap class access to the private members of Iterator. 
+    };
+};
+
+// Member template definitions. 
+// Unlike the other members, these cannot be explicitly instantiated in flatHashMap.cpp for every argument list,
+// so they are defined here where callers can see them. 
+
+// emplacer() function implementation: 
+// Constructs an entry from (args), whose key is known to be absent, in the first free slot of its probe sequence. 
+// If the table has to grow first, the entry is built before resizing (the arguments may refer to entries that the
+// resize moves) and then moved into its new slot. 
+template <typename K, typename V, typename H>
+template <typename... Args>
+typename FlatHashMap<K, V, H>::Iterator FlatHashMap<K, V, H>::emplacer(std::size_t h, Args&&... args) {
+    int i = findFree(h);                          // Candidate slot. 
+    if (ctrl[i] == EMPTY && growthLeft == 0) {    // Filling another EMPTY slot would exceed the load limit: 
+        Entry e(std::forward<Args>(args)...);     // build the entry while its arguments are still valid, 
+        resize(n + 1 > bucketCount() / 2 ? bucketCount() * 2 : bucketCount()); // grow, or just purge DELETED markers, 
+        i = findFree(h);                          // look for a slot in the new table, 
+        new (&slots[i]) Entry(std::move(e));      // and move the entry into it. 
+    } else {
+        new (&slots[i]) Entry(std::forward<Args>(args)...); // Construct the entry in place. 
+    }
+    if (ctrl[i] == EMPTY) growthLeft--;           // Reusing a DELETED slot does not consume growth. 
+    ctrl[i] = h2(h);                              // Publish its tag. 
+    n++;                                          // Increment the count of entries in the map by 1. 
+    return Iterator(this, i);
+}
+
+// emplace() function implementation: 
+// Builds the entry first to learn its key, then moves it into a slot if the key is absent. 
+template <typename K, typename V, typename H>
+template <typename... Args>
+std::pair<typename FlatHashMap<K, V, H>::Iterator, bool> FlatHashMap<K, V, H>::emplace(Args&&... args) {
+    Entry e(std::in_place, std::forward<Args>(args)...); // The new entry. 
+    std::size_t h = mix(hash(e.key()));                   // Hash its key once. 
+    int i = finder(e.key(), h);                           // Slot of an entry with the same key, or -1. 
+    if (i >= 0) return std::pair<Iterator, bool>(Iterator(this, i), false); // Present: discard the new entry. 
+    return std::pair<Iterator, bool>(emplacer(h, std::move(e)), true);
+}
+
+// try_emplace(const K&, ...) function implementation: 
+// Constructs the value from (args) only if key (k) is absent. 
+template <typename K, typename V, typename H>
+template <typename... Args>
+std::pair<typename FlatHashMap<K, V, H>::Iterator, bool> FlatHashMap<K, V, H>::try_emplace(const K& k, Args&&... args) {
+    std::size_t h = mix(hash(k));                         // Hash key (k) once. 
+    int i = finder(k, h);                                 // Slot of key (k), or -1. 
+    if (i >= 0) return std::pair<Iterator, bool>(Iterator(this, i), false); // Present: leave the entry (and args) alone. 
+    return std::pair<Iterator, bool>(emplacer(h, std::in_place, k, std::forward<Args>(args)...), true);
+}
+
+// try_emplace(K&&, ...) function implementation: 
+// Same as above, but moves key (k) into the new entry. 
+template <typename K, typename V, typename H>
+template <typename... Args>
+std::pair<typename FlatHashMap<K, V, H>::Iterator, bool> FlatHashMap<K, V, H>::try_emplace(K&& k, Args&&... args) {
+    std::size_t h = mix(hash(k));                         // Hash key (k) once. 
+    int i = finder(k, h);                                 // Slot of key (k), or -1. 
+    if (i >= 0) return std::pair<Iterator, bool>(Iterator(this, i), false); // Present: leave the entry (and args) alone. 
+    return std::pair<Iterator, bool>(emplacer(h, std::in_place, std::move(k), std::forward<Args>(args)...), true);
+}
+
+// insert_or_assign(const K&, M&&) function implementation: 
+// Assigns (v) to an existing entry, or constructs a new entry from (k) and (v). 
+template <typename K, typename V, typename H>
+template <typename M>
+std::pair<typename FlatHashMap<K, V, H>::Iterator, bool> FlatHashMap<K, V, H>::insert_or_assign(const K& k, M&& v) {
+    std::size_t h = mix(hash(k));                         // Hash key (k) once. 
+    int i = finder(k, h);                                 // Slot of key (k), or -1. 
+    if (i >= 0) {                                         // Present: assign the new value. 
+        slots[i].setValue(std::forward<M>(v));
+        return std::pair<Iterator, bool>(Iterator(this, i), false);
+    }
+    return std::pair<Iterator, bool>(emplacer(h, std::in_place, k, std::forward<M>(v)), true);
+}
+
+// insert_or_assign(K&&, M&&) function implementation: 
+// Same as above, but moves key (k) into a new entry. 
+template <typename K, typename V, typename H>
+template <typename M>
+std::pair<typename FlatHashMap<K, V, H>::Iterator, bool> FlatHashMap<K, V, H>::insert_or_assign(K&& k, M&& v) {
+    std::size_t h = mix(hash(k));                         // Hash key (k) once. 
+    int i = finder(k, h);                                 // Slot of key (k), or -1. 
+    if (i >= 0) {                                         // Present: assign the new value. 
+        slots[i].setValue(std::forward<M>(v));
+        return std::pair<Iterator, bool>(Iterator(this, i), false);
+    }
+    return std::pair<Iterator, bool>(emplacer(h, std::in_place, std::move(k), std::forward<M>(v)), true);
+}
+
+// findMany() function implementation: 
+// Works in three passes over each batch: (1) hash every key and prefetch the control bytes of its first group,
+// (2) prefetch the first slot whose tag matches, (3) search with the data (usually) in cache. 
+template <typename K, typename V, typename H>
+template <typename KeyIt, typename OutIt>
+OutIt FlatHashMap<K, V, H>::findMany(KeyIt first, KeyIt last, OutIt out) {
+    std::size_t hs[BATCH];                        // Mixed hash of every key in the current batch. 
+    std::size_t groups = bucketCount() / GROUP_WIDTH;
+    while (first != last) {
+        KeyIt start = first;                      // First key of this batch. 
+        int m = 0;                                // Number of keys in this batch. 
+        for (; m < BATCH && first != last; ++m, ++first) { // Pass 1: hash and prefetch the control bytes. 
+            hs[m] = mix(hash(*first));
+            prefetchRead(&ctrl[(h1(hs[m]) & (groups - 1)) * GROUP_WIDTH]);
+        }
+        for (int j = 0; j < m; j++) {             // Pass 2: prefetch the first candidate slot. 
+            std::size_t base = (h1(hs[j]) & (groups - 1)) * GROUP_WIDTH;
+            unsigned match = ProbeGroup(&ctrl[base]).match(h2(hs[j]));
+            if (match != 0) prefetchRead(&slots[base + ProbeGroup::lowestBit(match)]);
+        }
+        for (int j = 0; j < m; j++, ++start) {    // Pass 3: search. 
+            int i = finder(*start, hs[j]);
+            *out = i < 0 ? end() : Iterator(this, i);
+            ++out;
+        }
+    }
+    return out;
+}
+
+// putMany() function implementation: 
+// Reserves room for every key first, so no insertion of a batch triggers a resize. 
+template <typename K, typename V, typename H>
+template <typename KeyIt, typename ValIt>
+void FlatHashMap<K, V, H>::putMany(KeyIt first, KeyIt last, ValIt values) {
+    int count = 0;                                // Count the keys (without consuming them) to reserve room. 
+    for (KeyIt it = first; it != last; ++it) count++;
+    reserve(n + count);
+    std::size_t hs[BATCH];                        // Mixed hash of every key in the current batch. 
+    std::size_t groups = bucketCount() / GROUP_WIDTH;
+    while (first != last) {
+        KeyIt start = first;                      // First key of this batch. 
+        int m = 0;                                // Number of keys in this batch. 
+        for (; m < BATCH && first != last; ++m, ++first) { // Pass 1: hash and prefetch the control bytes. 
+            hs[m] = mix(hash(*first));
+            prefetchRead(&ctrl[(h1(hs[m]) & (groups - 1)) * GROUP_WIDTH]);
+        }
+        for (int j = 0; j < m; j++, ++start, ++values) { // Pass 2: insert or assign. 
+            int i = finder(*start, hs[j]);
+            if (i >= 0) slots[i].setValue(*values);      // Existing key: replace the value. 
+            else emplacer(hs[j], std::in_place, *start, *values); // New key: room was reserved above. 
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,189 @@
+#include "frozenHashMap.h" // Includes the definition of the FrozenHashMap class.
+
+#include <algorithm> // Includes std::sort and std::find.
+#include <numeric>   // Includes std::iota.
+
+// FrozenHashMap constructor implementation: 
+// An empty map has no entries and a single, unused displacement bucket. 
+template <typename K, typename V, typename H>
+FrozenHashMap<K, V, H>::FrozenHashMap() : primary(0), positions(0), salt(0), D(1, 0) { }
+
+// mix() function implementation: 
+// The 64-bit finalizer of MurmurHash3, so that the bucket and the position of a key are well spread even for a weak 
+// hash function such as stringHash.
+template <typename K, typename V, typename H>
+std::uint64_t FrozenHashMap<K, V, H>::mix(std::uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdull;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ull;
+    x ^= x >> 33;
+    return x;
+}
+
+// salted() function implementation: 
+// Mixes hash value (h) with the salt. Different salts give unrelated buckets and positions for the same keys. 
+template <typename K, typename V, typename H>
+std::uint64_t FrozenHashMap<K, V, H>::salted(std::uint64_t h) const { return mix(h + salt * 0x9E3779B97F4A7C15ull); }
+
+// bucketOf() function implementation: 
+// Maps the low 32 bits of (g) onto [0, D.size()) with a multiplication instead of a modulo. 
+template <typename K, typename V, typename H>
+std::size_t FrozenHashMap<K, V, H>::bucketOf(std::uint64_t g) const {
+    return std::size_t(((g & 0xffffffffull) * D.size()) >> 32);
+}
+
+// positionOf() function implementation: 
+// Mixes (g) with displacement (d) and maps the high 32 bits of the result onto [0, positions). 
+template <typename K, typename V, typename H>
+std::size_t FrozenHashMap<K, V, H>::positionOf(std::uint64_t g, std::uint32_t d) const {
+    std::uint64_t x = mix(g ^ (d * 0xc2b2ae3d27d4eb4full));
+    return std::size_t(((x >> 32) * positions) >> 32);
+}
+
+// build() function implementation: 
+// Hashes every key once and sets aside all but one key of each group with equal hash values. Then chooses the 
+// displacements (with a new salt whenever a bucket cannot be placed), sends the positions past the last entry to the
+// free ones below it, and finally moves the entries into the position order.
+template <typename K, typename V, typename H>
+void FrozenHashMap<K, V, H>::build(EntryArray& E) {
+    std::size_t total = E.size();
+    std::vector<std::uint64_t> h(total);             // Hash value of every entry. 
+    for (std::size_t i = 0; i < total; i++) h[i] = hash(E[i].key());
+    std::vector<int> ord(total);                     // The entries sorted by hash value, so that collisions are adjacent. 
+    std::iota(ord.begin(), ord.end(), 0);
+    std::sort(ord.begin(), ord.end(), [&](int a, int b) { return h[a] < h[b]; });
+    std::vector<int> keys, dups;                     // Perfectly hashed entries, and overflow entries. 
+    for (std::size_t i = 0; i < total; i++) {
+        if (i > 0 && h[ord[i]] == h[ord[i - 1]]) dups.push_back(ord[i]);
+        else keys.push_back(ord[i]);
+    }
+    primary = keys.size();
+    positions = primary + primary / 100 + 1;         // 1% spare positions keep the last buckets quick to place. 
+    D.assign(primary > 0 ? (primary + LAMBDA - 1) / LAMBDA : 1, 0);
+
+    std::vector<std::uint64_t> g(total);             // Salted hash value of every entry. 
+    std::vector<int> at;                             // at[p]: the entry at position p, or -1. 
+    for (salt = 0;; salt++) {
+        for (int e : keys) g[e] = salted(h[e]);
+        if (displace(g, keys, at)) break;
+    }
+
+    remap.assign(positions - primary, 0);            // An unused position may map anywhere: the key comparison fails. 
+    std::size_t hole = 0;                            // The lowest free position below primary. 
+    for (std::size_t p = primary; p < positions; p++) {
+        if (at[p] < 0) continue;
+        while (at[hole] >= 0) hole++;
+        at[hole] = at[p];                            // Move the entry at p into the hole, 
+        remap[p - primary] = int(hole);              // and remember where it went. 
+    }
+
+    S.clear();
+    S.reserve(total);
+    for (std::size_t p = 0; p < primary; p++) S.push_back(std::move(E[at[p]]));
+    extra.clear();
+    for (int e : dups) {                             // The overflow list follows the perfectly hashed entries. 
+        S.push_back(std::move(E[e]));
+        extra.push_back(h[e]);
+    }
+}
+
+// displace() function implementation: 
+// Groups the (keys) by bucket and places the buckets from the largest to the smallest, trying displacements 0, 1, 2, 
+// ... for each until all of its keys fall on distinct free positions. Large buckets go first, while most positions
+// are still free. Returns false if some bucket exhausts MAX_SEED displacements.
+template <typename K, typename V, typename H>
+bool FrozenHashMap<K, V, H>::displace(const std::vector<std::uint64_t>& g, const std::vector<int>& keys, std::vector<int>& at) {
+    std::size_t r = D.size();
+    std::vector<int> start(r + 1, 0);                // Counting sort of the keys by bucket. 
+    for (int e : keys) start[bucketOf(g[e]) + 1]++;
+    for (std::size_t b = 0; b < r; b++) start[b + 1] += start[b];
+    std::vector<int> members(keys.size());
+    std::vector<int> fill(start.begin(), start.end() - 1);
+    for (int e : keys) members[fill[bucketOf(g[e])]++] = e;
+
+    std::vector<int> order(r);                       // The buckets, largest first. 
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return start[a + 1] - start[a] > start[b + 1] - start[b]; });
+
+    at.assign(positions, -1);
+    std::vector<std::size_t> pos;                    // Positions of the keys of the current bucket. 
+    for (int b : order) {
+        int first = start[b], count = start[b + 1] - first;
+        if (count == 0) break;                       // Only empty buckets are left. 
+        pos.resize(count);
+        std::uint32_t d = 0;
+        for (;; d++) {
+            if (d == MAX_SEED) return false;
+            int j = 0;
+            for (; j < count; j++) {
+                std::size_t p = positionOf(g[members[first + j]], d);
+                if (at[p] >= 0 || std::find(pos.begin(), pos.begin() + j, p) != pos.begin() + j) break;
+                pos[j] = p;
+            }
+            if (j == count) break;                   // Every key of the bucket has a position of its own. 
+        }
+        for (int j = 0; j < count; j++) at[pos[j]] = members[first + j];
+        D[b] = d;
+    }
+    return true;
+}
+
+// size() function implementation: 
+// Returns the number of entries, i.e. the length of the entry array S. 
+template <typename K, typename V, typename H>
+int FrozenHashMap<K, V, H>::size() const { return int(S.size()); }
+
+// empty() function implementation: 
+// Checks if the map is empty. 
+template <typename K, typename V, typename H>
+bool FrozenHashMap<K, V, H>::empty() const { return size() == 0; }
+
+// bucketCount() function implementation: 
+// Returns the number of displacements. 
+template <typename K, typename V, typename H>
+int FrozenHashMap<K, V, H>::bucketCount() const { return int(D.size()); }
+
+// collisionCount() function implementation: 
+// Returns the length of the overflow list. 
+template <typename K, typename V, typename H>
+int FrozenHashMap<K, V, H>::collisionCount() const { return int(extra.size()); }
+
+// indexBytes() function implementation: 
+// Adds up the arrays that are not entries. 
+template <typename K, typename V, typename H>
+std::size_t FrozenHashMap<K, V, H>::indexBytes() const {
+    return D.size() * sizeof(std::uint32_t) + remap.size() * sizeof(int) + extra.size() * sizeof(std::uint64_t);
+}
+
+// find() function implementation: 
+// Computes the position of key (k) and compares the entry there; only if it differs and there is an overflow list 
+// is that list searched.
+template <typename K, typename V, typename H>
+typename FrozenHashMap<K, V, H>::Iterator FrozenHashMap<K, V, H>::find(const LookupKey& k) {
+    if (empty()) return end();
+    std::uint64_t h = hash(k);
+    if (primary > 0) {
+        std::uint64_t g = salted(h);
+        std::size_t p = positionOf(g, D[bucketOf(g)]);
+        if (p >= primary) p = remap[p - primary];    // One of the positions past the last entry. 
+        if (S[p].key() == k) return Iterator(S, int(p));
+    }
+    for (std::size_t j = 0; j < extra.size(); j++)   // Empty unless (H) has collisions among the keys. 
+        if (extra[j] == h && S[primary + j].key() == k) return Iterator(S, int(primary + j));
+    return end();
+}
+
+// begin() function implementation: 
+// Returns an iterator to the first entry of the entry array. 
+template <typename K, typename V, typename H>
+typename FrozenHashMap<K, V, H>::Iterator FrozenHashMap<K, V, H>::begin() { return Iterator(S, 0); }
+
+// end() function implementation: 
+// Returns an iterator just past the last entry of the entry array. 
+template <typename K, typename V, typename H>
+typename FrozenHashMap<K, V, H>::Iterator FrozenHashMap<K, V, H>::end() { return Iterator(S, size()); }
+
+// Explicit instantiation of the FrozenHashMap template for std::string keys and int values.
+template class FrozenHashMap<std::string, int, stringHash>;
+template class FrozenHashMap<std::string, int, fastStringHash>;
\ No newline at end of file
@@ -0,0 +1,121 @@
+#pragma once // Ensures this header file is included only once.
+
+#include "hashMap.h" // Includes HashMap, MapEntry, LookupKeyOf, stringHash and fastStringHash.
+
+#include <cstdint> // Includes std::uint32_t and std::uint64_t.
+#include <utility> // Includes std::in_place.
+#include <vector>  // Includes std::vector, used for the entry array and the displacement array.
+
+// Template class FrozenHashMap. A read-only map built once from the entries of a HashMap, for tables that are filled
+// at startup and then only looked up. Its keys are placed with a minimal perfect hash (hash and displace, as in CHD):
+// the keys are split into buckets of about LAMBDA keys each, and every bucket stores one displacement, chosen at
+// build time so that the keys of all buckets land on distinct positions. A lookup computes its key's position from
+// the hash and its bucket's displacement, then compares the one entry found there, so every lookup (hit or miss)
+// reads a single entry, and no chain, empty slot or per-entry link is stored.
+// The entry array has exactly one entry per key. Positions are drawn from a range 1% larger than the number of keys,
+// which keeps the search for displacements short; the few keys that land past the end are sent to the positions
+// left free below it through a small table.
+// Two keys with exactly the same hash value cannot be told apart by any displacement. If (H) produces such
+// collisions, all but one key of each colliding group are kept in a short overflow list, searched only when the
+// entry at the computed position does not match.
+template <typename K, typename V, typename H>
+class FrozenHashMap {
+public:
+    typedef ::MapEntry<K, V> Entry; // Defines Entry type to represent a (key,value) pair; its key is read-only. 
+    typedef typename LookupKeyOf<K, H>::type LookupKey; // Type accepted by find(). 
+
+    // Declaration of the inner Iterator class for FrozenHashMap. 
+    class Iterator;
+
+public:
+    // Constructor: An empty map. 
+    FrozenHashMap();
+
+    // Freezing constructor: Copies every entry of (map) and builds the perfect hash over their keys. 
+    // (map) is not modified; it is taken by non-const reference only because HashMap::begin() is not const. 
+    template <typename A, typename P>
+    explicit FrozenHashMap(HashMap<K, V, H, A, P>& map);
+
+    // Returns the number of entries (key-value pairs) in the map. 
+    int size() const;
+
+    // Returns true if the map is empty. 
+    bool empty() const;
+
+    // Returns the number of displacement buckets. 
+    int bucketCount() const;
+
+    // Returns the number of entries kept in the overflow list because their hash value equals another key's. 
+    int collisionCount() const;
+
+    // Returns the bytes used besides the entries themselves: displacements, the remapping table and the overflow hashes. 
+    std::size_t indexBytes() const;
+
+    // Finds an entry with key k and returns an iterator to it. 
+    Iterator find(const LookupKey& k);
+
+    // Returns an iterator to the first entry in the map. 
+    Iterator begin();
+
+    // Returns an iterator to the end entry (past-the-end) of the map. 
+    Iterator end();
+
+    static constexpr int LAMBDA = 4;                 // Average number of keys per displacement bucket. 
+    static constexpr std::uint32_t MAX_SEED = 1u << 16; // Displacements tried for a bucket before starting over with a new salt. 
+
+protected:
+    typedef std::vector<Entry> EntryArray; // Defines 'EntryArray' as the array holding the entries. 
+
+    // Utility functions for FrozenHashMap operations. 
+    static std::uint64_t mix(std::uint64_t x);   // Spreads the bits of (x) over all 64 bits. 
+    std::uint64_t salted(std::uint64_t h) const; // The value of hash value (h) under the current salt. 
+    std::size_t bucketOf(std::uint64_t g) const; // The displacement bucket of salted hash (g). 
+    std::size_t positionOf(std::uint64_t g, std::uint32_t d) const; // The position of salted hash (g) under displacement (d). 
+    void build(EntryArray& E);                   // Internal utility function building the map from the entries (E). 
+    bool displace(const std::vector<std::uint64_t>& g, const std::vector<int>& keys, std::vector<int>& at); // Internal utility function choosing every displacement. 
+
+private:
+    H hash;                          // The hash function object. 
+    EntryArray S;                    // The entries: the perfectly hashed ones first, then the overflow list. 
+    std::size_t primary;             // Number of perfectly hashed entries. 
+    std::size_t positions;           // Size of the position range (a little larger than primary). 
+    std::uint64_t salt;              // Salt of the hash values, changed if no displacement fits a bucket. 
+    std::vector<std::uint32_t> D;    // Displacement of every bucket. 
+    std::vector<int> remap;          // Entry index of positions [primary, positions). 
+    std::vector<std::uint64_t> extra; // Hash value of every overflow entry. 
+
+public:
+    // Definition of the FrozenHashMap::Iterator class. 
+    class Iterator {
+    private:
+        int idx;         // The position of the entry within the entry array. 
+        EntryArray* ea;  // A pointer to the entry array this iterator belongs to. 
+
+    public:
+        // Iterator constructor: Initializes the iterator with the entry array (a) and a position (i) in it. 
+        Iterator(EntryArray& a, int i) : idx(i), ea(&a) { }
+
+        // Overloads the dereference operator to return a reference to the Entry pointed to by the iterator. 
+        Entry& operator*() const { return (*ea)[idx]; }
+        // Overloads the equality operator to compare if two Iterator objects point to the same location. 
+        bool operator==(const Iterator& p) const { return ea == p.ea && idx == p.idx; }
+        // Overloads the pre-increment operator to advance the iterator to the next entry. 
+        Iterator& operator++() { ++idx; return *this; }
+
+        friend class FrozenHashMap; // Grants the FrozenHashMap class access to the private members of Iterator. 
+    };
+};
+
+// Member template definitions.
+
+// Freezing constructor implementation: 
+// Copies the entries of (map) into a temporary array and builds the map from it. 
+template <typename K, typename V, typename H>
+template <typename A, typename P>
+FrozenHashMap<K, V, H>::FrozenHashMap(HashMap<K, V, H, A, P>& map) : FrozenHashMap() {
+    EntryArray E;
+    E.reserve(map.size());
+    for (typename HashMap<K, V, H, A, P>::Iterator it = map.begin(); !(it == map.end()); ++it)
+        E.emplace_back(std::in_place, (*it).key(), (*it).value());
+    build(E);
+}
\ No newline at end of file
@@ -1,150 +1,334 @@
 #include "hashMap.h" // Includes the definition of the HashMap class.
+#include "poolAllocator.h" // Includes PoolAllocator, for the pooled instantiation at the end of this file.
 
 #include <iostream> // Includes iostream for standard input/output operations.
-#include <list>     // Includes the std::list container.
 #include <vector>   // Includes the std::vector container.
 
 // HashMap constructor implementation: 
-// Initializes the bucket array B with the given capacity and sets the number of entries n to 0. 
-template <typename K, typename V, typename H>
-HashMap<K, V, H>::HashMap(int capacity) : n(0), B(capacity) {} 
+// Initializes the bucket array B with the given capacity, every bucket empty (-1), and starts with a maximum load
+// factor of 1 (one entry per bucket on average). In power-of-two mode the capacity is rounded up to the next power of two. 
+template <typename K, typename V, typename H, typename A, typename P>
+HashMap<K, V, H, A, P>::HashMap(int capacity, bool powerOfTwo, const A& a)
+    : maxLoad(1.0f), pow2(powerOfTwo), S(SlotAlloc(a)), B(HeadAlloc(a)) {
+    int buckets = 1;                                 // Start from one bucket, 
+    if (!pow2) buckets = capacity > 0 ? capacity : 1; // and use the capacity as is, 
+    else while (buckets < capacity) buckets *= 2;     // or round it up to a power of two. 
+    B.assign(buckets, -1);                           // Every bucket starts with an empty chain. 
+} 
+
+// bucketOf() function implementation: 
+// Maps a hash value (h) to a bucket index, masking in power-of-two mode and using the modulo otherwise. 
+template <typename K, typename V, typename H, typename A, typename P>
+std::size_t HashMap<K, V, H, A, P>::bucketOf(std::size_t h) const {
+    return pow2 ? (h & (B.size() - 1)) : (h % B.size());
+}
 
 // size() function implementation: 
-// Returns the current number of entries (n) in the HashMap. 
-template <typename K, typename V, typename H>
-int HashMap<K, V, H>::size() const { return n; } 
+// Returns the current number of entries in the HashMap, i.e. the length of the entry array S. 
+template <typename K, typename V, typename H, typename A, typename P>
+int HashMap<K, V, H, A, P>::size() const { return int(S.size()); } 
 
 // empty() function implementation: 
 // Checks if the HashMap is empty (i.e., if the number of entries is 0). 
-template <typename K, typename V, typename H>
-bool HashMap<K, V, H>::empty() const { return size() == 0; } 
+template <typename K, typename V, typename H, typename A, typename P>
+bool HashMap<K, V, H, A, P>::empty() const { return size() == 0; } 
+
+// bucketCount() function implementation: 
+// Returns the number of buckets in the bucket array B. 
+template <typename K, typename V, typename H, typename A, typename P>
+int HashMap<K, V, H, A, P>::bucketCount() const { return B.size(); } 
+
+// loadFactor() function implementation: 
+// Returns the average number of entries per bucket. 
+template <typename K, typename V, typename H, typename A, typename P>
+float HashMap<K, V, H, A, P>::loadFactor() const { return float(size()) / B.size(); } 
+
+// maxLoadFactor() function implementation: 
+// Returns the load factor above which the bucket array is grown. 
+template <typename K, typename V, typename H, typename A, typename P>
+float HashMap<K, V, H, A, P>::maxLoadFactor() const { return maxLoad; } 
+
+// setMaxLoadFactor() function implementation: 
+// Stores the new maximum load factor and rehashes immediately if the map is already above it. 
+template <typename K, typename V, typename H, typename A, typename P>
+void HashMap<K, V, H, A, P>::setMaxLoadFactor(float f) {
+    if (f <= 0) return;  // A non-positive load factor is meaningless; keep the current one. 
+    maxLoad = f;         // Remember the new limit. 
+    if (loadFactor() > maxLoad) // If the map already exceeds the new limit, 
+        reserve(size());        // grow the bucket array so that it fits again. 
+}
+
+// reserve() function implementation: 
+// Grows the entry array to hold (count) entries and the bucket array so that they fit without exceeding the
+// maximum load factor. 
+template <typename K, typename V, typename H, typename A, typename P>
+void HashMap<K, V, H, A, P>::reserve(int count) {
+    if (count > 0) reserveSlots(count); // Later insertions will not reallocate the entry array. 
+    int need = int(count / maxLoad) + 1; // Number of buckets required to keep (count) entries under the limit. 
+    if (need > bucketCount())        // Only ever grow; reserve() never shrinks the bucket array. 
+        rehash(need);
+}
+
+// rehash() function implementation: 
+// Builds a new bucket array with the requested number of buckets and relinks every entry into it. 
+// Entries stay where they are in S and their hashes are cached, so only the chain links are rewritten. 
+template <typename K, typename V, typename H, typename A, typename P>
+void HashMap<K, V, H, A, P>::rehash(int buckets) {
+    int minimum = int(size() / maxLoad) + 1; // Never rehash into fewer buckets than the load factor allows. 
+    if (buckets < minimum) buckets = minimum;
+    if (pow2) {                          // In power-of-two mode, round the bucket count up to a power of two. 
+        int rounded = 1;
+        while (rounded < buckets) rounded *= 2;
+        buckets = rounded;
+    }
+    std::chrono::steady_clock::time_point start;
+    if (P::enabled) start = std::chrono::steady_clock::now(); // Only read the clock if the policy records it. 
+    B.assign(buckets, -1);               // The new, empty bucket array. 
+    for (int i = 0; i < size(); i++)     // Link every entry into its bucket in the new array. 
+        link(i);
+    if (P::enabled)
+        probeStats.rehash(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+// link() function implementation: 
+// Pushes entry (i) onto the front of the chain of its bucket. 
+template <typename K, typename V, typename H, typename A, typename P>
+void HashMap<K, V, H, A, P>::link(int i) {
+    std::size_t b = bucketOf(S[i].hash); // The bucket of entry (i). 
+    S[i].next = B[b];                    // The old head of the chain follows the entry, 
+    B[b] = i;                            // which becomes the new head. 
+}
+
+// linkAll() function implementation: 
+// Links every entry of S into the bucket array, which must be empty. With several threads the bucket array is split 
+// into (threads) contiguous ranges, and the entries are first grouped by the thread owning their bucket (a counting 
+// sort over chunks of S, done in parallel). Each thread then links only its own entries, in index order, so no two 
+// threads write to the same bucket and the chains come out exactly as a sequential pass would build them. 
+template <typename K, typename V, typename H, typename A, typename P>
+void HashMap<K, V, H, A, P>::linkAll(int threads) {
+    std::size_t n = S.size(), nb = B.size();
+    if (threads <= 1 || n < std::size_t(threads) * LINK_GRAIN) { // Too little work for threads: link in order. 
+        for (int i = 0; i < size(); i++) link(i);
+        return;
+    }
+    std::size_t T = std::size_t(threads);
+    std::vector<int> bkt(n);                         // Bucket of every entry. 
+    std::vector<std::size_t> cnt(T * T, 0);          // cnt[c * T + o]: entries of chunk c in the buckets of thread o. 
+    parallelFor(n, threads, [&](int c, std::size_t lo, std::size_t hi) { // Pass 1: find and count the buckets. 
+        std::vector<std::size_t> local(T, 0);        // Counted locally, so the threads do not share cache lines. 
+        for (std::size_t i = lo; i < hi; i++) {
+            bkt[i] = int(bucketOf(S[i].hash));
+            local[std::size_t(bkt[i]) * T / nb]++;
+        }
+        std::copy(local.begin(), local.end(), cnt.begin() + c * T);
+    });
+    std::vector<std::size_t> pos(T * T), from(T + 1); // pos[o * T + c]: where chunk c puts the entries of thread o. 
+    std::size_t p = 0;
+    for (std::size_t o = 0; o < T; o++) {            // Owner by owner, chunk by chunk: index order within an owner. 
+        from[o] = p;
+        for (std::size_t c = 0; c < T; c++) {
+            pos[o * T + c] = p;
+            p += cnt[c * T + o];
+        }
+    }
+    from[T] = n;
+    std::vector<int> order(n);                       // The entries grouped by owner. 
+    parallelFor(n, threads, [&](int c, std::size_t lo, std::size_t hi) { // Pass 2: scatter the entries. 
+        std::vector<std::size_t> next(T);
+        for (std::size_t o = 0; o < T; o++) next[o] = pos[o * T + c];
+        for (std::size_t i = lo; i < hi; i++) order[next[std::size_t(bkt[i]) * T / nb]++] = int(i);
+    });
+    parallelFor(T, threads, [&](int, std::size_t lo, std::size_t hi) { // Pass 3: every thread links its entries. 
+        for (std::size_t o = lo; o < hi; o++) {
+            for (std::size_t q = from[o]; q < from[o + 1]; q++) {
+                int i = order[q];
+                S[i].next = B[bkt[i]];
+                B[bkt[i]] = i;
+            }
+        }
+    });
+}
+
+// reserveSlots() function implementation: 
+// Reallocates S with room for (count) entries; std::vector moves the entries (the indices do not change). 
+template <typename K, typename V, typename H, typename A, typename P>
+void HashMap<K, V, H, A, P>::reserveSlots(std::size_t count) {
+    S.reserve(count);
+}
+
+// adopt() function implementation: 
+// Makes the entry just constructed at the end of S reachable. If the map now exceeds the maximum load factor the
+// bucket array is doubled, which links every entry including the new one; otherwise only the new entry is linked. 
+template <typename K, typename V, typename H, typename A, typename P>
+typename HashMap<K, V, H, A, P>::Iterator HashMap<K, V, H, A, P>::adopt() {
+    int i = size() - 1;                  // The new entry is the last one. 
+    if (size() > maxLoad * B.size())    // Too many entries for the current bucket array: 
+        rehash(2 * B.size());            // double it (this links the new entry too). 
+    else
+        link(i);
+    return Iterator(S, i);
+}
 
 // Iterator::operator*() implementation: 
 // Returns a reference to the Entry object pointed to by the iterator. 
-template <typename K, typename V, typename H>
-typename HashMap<K, V, H>::Entry&
-HashMap<K, V, H>::Iterator::operator*() const {
-    return *ent; // Dereferences the internal entry iterator (ent) and returns the value. 
+template <typename K, typename V, typename H, typename A, typename P>
+typename HashMap<K, V, H, A, P>::Entry&
+HashMap<K, V, H, A, P>::Iterator::operator*() const {
+    return (*sa)[idx].entry; // Returns the entry stored at position (idx) of the entry array. 
 }
 
 // Iterator::operator==() implementation: 
 // Compares if two Iterator objects point to the same location. 
-template <typename K, typename V, typename H>
-bool HashMap<K, V, H>::Iterator::operator==(const Iterator& p) const {
-    // If the bucket array pointer (ba) or the bucket iterator (bkt) are different, the iterators are not equal. 
-    if (ba != p.ba || bkt != p.bkt) return false;
-    // If both iterators are at the end of the bucket array, they are considered equal. 
-    else if (bkt == ba->end()) return true;
-    // Otherwise, equality is determined by comparing the internal entry iterators (ent). 
-    else return (ent == p.ent);
+template <typename K, typename V, typename H, typename A, typename P>
+bool HashMap<K, V, H, A, P>::Iterator::operator==(const Iterator& p) const {
+    return sa == p.sa && idx == p.idx; // Same entry array and same position. 
 }
 
 // Iterator::operator++() implementation: 
-// Advances the iterator to the next entry. 
-template <typename K, typename V, typename H>
-typename HashMap<K, V, H>::Iterator& HashMap<K, V, H>::Iterator::operator++() {
-    ++ent; // Move to the next entry within the current bucket. 
-    if (endOfBkt(*this)) { // Check if the end of the current bucket has been reached. 
-        ++bkt; // Move to the next bucket in the bucket array. 
-        while (bkt != ba->end() && bkt->empty()) // Find the next non-empty bucket. 
-            ++bkt;
-        if (bkt == ba->end()) return *this; // If the end of the bucket array is reached, return the current iterator. 
-        ent = bkt->begin(); // Set the entry iterator to the beginning of the newly found non-empty bucket. 
-    }
+// Advances the iterator to the next entry, which is simply the next element of the entry array. 
+template <typename K, typename V, typename H, typename A, typename P>
+typename HashMap<K, V, H, A, P>::Iterator& HashMap<K, V, H, A, P>::Iterator::operator++() {
+    ++idx;        // Move to the next position. 
     return *this; // Return the modified iterator itself. 
 }
 
 // end() function implementation: 
 // Returns an iterator pointing to the end (past-the-end) of the HashMap. 
-template <typename K, typename V, typename H>
-typename HashMap<K, V, H>::Iterator HashMap<K, V, H>::end() {
-    return Iterator(B, B.end()); // Creates and returns an iterator pointing to the end of the bucket array (B). 
+template <typename K, typename V, typename H, typename A, typename P>
+typename HashMap<K, V, H, A, P>::Iterator HashMap<K, V, H, A, P>::end() {
+    return Iterator(S, size()); // The position just past the last entry of the entry array (S). 
 }
 
 // begin() function implementation: 
 // Returns an iterator pointing to the first entry in the HashMap. 
-template <typename K, typename V, typename H>
-typename HashMap<K, V, H>::Iterator HashMap<K, V, H>::begin() {
-    if (empty()) return end(); // If the HashMap is empty, return the end() iterator. 
-    Bltor bkt = B.begin();     // Start searching from the beginning of the bucket array. 
-    while (bkt->empty()) ++bkt; // Find the first non-empty bucket. 
-    return Iterator(B, bkt, bkt->begin()); // Create and return an iterator pointing to the first entry of the found bucket. 
+template <typename K, typename V, typename H, typename A, typename P>
+typename HashMap<K, V, H, A, P>::Iterator HashMap<K, V, H, A, P>::begin() {
+    return Iterator(S, 0); // The first entry of the entry array; equal to end() if the map is empty. 
 }
 
 // finder() function implementation: 
-// Finds the entry corresponding to the given key (k) and returns an iterator to its position. 
-// If the key is not found, it returns an iterator to the end of the respective bucket (endOfBkt). 
-template <typename K, typename V, typename H>
-typename HashMap<K, V, H>::Iterator HashMap<K, V, H>::finder(const K& k) {
-    int i = hash(k) % B.size();       // Calculate the hash index (i) for the key (k) by modulo with bucket array size. 
-    Bltor bkt = B.begin() + i;        // Get an iterator to the i-th bucket. 
-    Iterator p(B, bkt, bkt->begin()); // Create an iterator (p) pointing to the beginning of the i-th bucket. 
-    // Search for key (k) by iterating through the bucket until the end of the bucket is reached or the key is found. 
-    while (!endOfBkt(p) && (*p).key() != k)
-        nextEntry(p); // Advance iterator p to the next entry. 
-    return p; // Return the final position (either the entry or the end of the bucket). 
+// Finds the entry with key (k), whose hash value is (h), and returns its index in S, or -1 if the key is absent. 
+template <typename K, typename V, typename H, typename A, typename P>
+int HashMap<K, V, H, A, P>::finder(const LookupKey& k, std::size_t h, StatOp op) const {
+    return finderIn(bucketOf(h), k, h, op); // Calculate the bucket index for the key (k) from its hash value and search it. 
+}
+
+// finderIn() function implementation: 
+// Searches bucket (i), which must be the bucket of key (k) with hash (h), for the key. Used directly when the bucket
+// index is already known (e.g. by findMany()). Keys are only compared when the cached hashes match. 
+// The number of entries visited is reported to the statistics policy as the probe length of operation (op). 
+template <typename K, typename V, typename H, typename A, typename P>
+int HashMap<K, V, H, A, P>::finderIn(std::size_t i, const LookupKey& k, std::size_t h, StatOp op) const {
+    int j = B[i];                        // Start at the head of the chain of bucket (i). 
+    int probes = 0;                      // Number of entries visited. 
+    // Follow the chain until its end is reached or the key is found. 
+    while (j >= 0 && (++probes, !(S[j].hash == h && S[j].entry.key() == k)))
+        j = S[j].next;                   // Advance to the next entry of the chain. 
+    probeStats.probe(op, probes);        // Compiles away with the NoStats policy. 
+    return j; // Return the index of the entry, or -1 if the chain ended. 
 }
 
 // find() function implementation: 
 // Finds the entry for the given key (k) and returns an iterator to it. 
-template <typename K, typename V, typename H>
-typename HashMap<K, V, H>::Iterator HashMap<K, V, H>::find(const K& k) {
-    Iterator p = finder(k); // Use the finder utility function to look for key (k). 
-    if (endOfBkt(p))         // If the key was not found (i.e., p points to the end of a bucket), 
-        return end();        // Return the HashMap's end() iterator. 
+template <typename K, typename V, typename H, typename A, typename P>
+typename HashMap<K, V, H, A, P>::Iterator HashMap<K, V, H, A, P>::find(const LookupKey& k) {
+    int i = finder(k, hash(k), StatOp::Find); // Use the finder utility function to look for key (k). 
+    if (i < 0)                  // If the key was not found, 
+        return end();           // Return the HashMap's end() iterator. 
     else
-        return p; // If the key was found, return the iterator (p) to its position. 
-}
-
-// inserter() function implementation: 
-// Inserts a new entry (e) at the position pointed to by the iterator (p). 
-template <typename K, typename V, typename H>
-typename HashMap<K, V, H>::Iterator HashMap<K, V, H>::inserter(const Iterator& p, const Entry& e) {
-    Eltor ins = p.bkt->insert(p.ent, e); // Insert the new entry (e) before the position p.ent in p.bkt (current bucket). 
-    n++; // Increment the count of entries in the HashMap by 1. 
-    return Iterator(B, p.bkt, ins); // Create and return an iterator pointing to the newly inserted entry. 
+        return Iterator(S, i);  // If the key was found, return an iterator to its position. 
 }
 
 // put() function implementation: 
 // Inserts a (k, v) pair into the HashMap, or replaces the value if key (k) already exists. 
-template <typename K, typename V, typename H>
-typename HashMap<K, V, H>::Iterator HashMap<K, V, H>::put(const K& k, const V& v) {
-    Iterator p = finder(k); // Search for key (k) using the finder utility function. 
-    if (endOfBkt(p)) { // If key (k) was not found (i.e., p points to the end of a bucket), 
-        return inserter(p, Entry(k, v)); // Insert a new entry (k, v) at the end of the bucket and return its position. 
-    } else { // If key (k) was found, 
-        p.ent->setValue(v); // Replace the value of the existing entry (pointed to by p.ent) with the new value (v). 
-        return p; // Return the position of the updated entry. 
-    }
+template <typename K, typename V, typename H, typename A, typename P>
+typename HashMap<K, V, H, A, P>::Iterator HashMap<K, V, H, A, P>::put(const K& k, const V& v) {
+    std::size_t h = hash(k); // Hash key (k) once; the hash is kept with the entry. 
+    int i = finder(k, h, StatOp::Insert); // Search for key (k) using the finder utility function. 
+    if (i < 0)               // If key (k) was not found, 
+        return emplacer(h, std::in_place, k, v); // build the new entry (k, v) directly in the entry array. 
+    S[i].entry.setValue(v);  // If key (k) was found, replace the value of the existing entry with the new value (v). 
+    return Iterator(S, i);   // Return the position of the updated entry. 
+}
+
+// put(K&&, V&&) function implementation: 
+// Same as put() above, but moves the key and the value into the map. 
+template <typename K, typename V, typename H, typename A, typename P>
+typename HashMap<K, V, H, A, P>::Iterator HashMap<K, V, H, A, P>::put(K&& k, V&& v) {
+    std::size_t h = hash(k); // Hash key (k) once. 
+    int i = finder(k, h, StatOp::Insert); // Search for key (k) using the finder utility function. 
+    if (i < 0)               // If key (k) was not found, 
+        return emplacer(h, std::in_place, std::move(k), std::move(v)); // move (k, v) into a new entry. 
+    S[i].entry.setValue(std::move(v)); // Move the new value (v) into the existing entry. 
+    return Iterator(S, i);   // Return the position of the updated entry. 
 }
 
 // eraser() function implementation: 
-// Removes the entry pointed to by the iterator (p) from its bucket. 
-template <typename K, typename V, typename H>
-void HashMap<K, V, H>::eraser(const Iterator& p) {
-    p.bkt->erase(p.ent); // Erase the entry pointed to by p.ent from its bucket (p.bkt). 
-    n--; // Decrement the number of entries in the HashMap by 1. 
+// Removes entry (i). It is unlinked from its chain, then the last entry of S is moved into its slot (and the link
+// pointing to the last entry redirected to i), so the entry array never has gaps. 
+template <typename K, typename V, typename H, typename A, typename P>
+void HashMap<K, V, H, A, P>::eraser(int i) {
+    int* p = &B[bucketOf(S[i].hash)];    // Find the link pointing to entry (i), 
+    while (*p != i) p = &S[*p].next;
+    *p = S[i].next;                      // and bypass the entry. 
+    int last = size() - 1;
+    if (i != last) {                     // Fill the hole with the last entry: 
+        int* q = &B[bucketOf(S[last].hash)]; // find the link pointing to it, 
+        while (*q != last) q = &S[*q].next;
+        *q = i;                          // point it to its new position, 
+        S[i] = std::move(S[last]);       // and move the entry there. 
+    }
+    S.pop_back();                        // The last slot is now unused. 
 }
 
 // erase(const Iterator& p) function implementation: 
 // Deletes the entry pointed to by iterator p. Internally calls the eraser utility. 
-template <typename K, typename V, typename H>
-void HashMap<K, V, H>::erase(const Iterator& p) {
-    eraser(p); // Calls the eraser function to perform the actual deletion. 
+template <typename K, typename V, typename H, typename A, typename P>
+void HashMap<K, V, H, A, P>::erase(const Iterator& p) {
+    eraser(p.idx); // Calls the eraser function to perform the actual deletion. 
 }
 
 // erase(const K& k) function implementation: 
 // Deletes the entry corresponding to the given key (k) from the map. 
-template <typename K, typename V, typename H>
-void HashMap<K, V, H>::erase(const K& k) {
-    Iterator p = finder(k); // Find the key (k) to be erased using the finder utility function. 
-    if (endOfBkt(p))         // If the key was not found (i.e., p points to the end of a bucket), 
+template <typename K, typename V, typename H, typename A, typename P>
+void HashMap<K, V, H, A, P>::erase(const LookupKey& k) {
+    int i = finder(k, hash(k), StatOp::Erase); // Find the key (k) to be erased using the finder utility function. 
+    if (i < 0)                  // If the key was not found, 
         // throw NonexistentElement("Erase of nonexistent"); // A throw could be added here for erasing a non-existent element. (Currently commented out) 
         return; // The assignment example seems to do nothing instead of throwing an error.
-    eraser(p); // If the key was found, call the eraser function to remove the entry. 
+    eraser(i); // If the key was found, call the eraser function to remove the entry. 
 }
 
+// stats() function implementation: 
+// Measures the length of every bucket chain and lets the statistics policy add its counters. 
+template <typename K, typename V, typename H, typename A, typename P>
+HashMapStats HashMap<K, V, H, A, P>::stats() const {
+    HashMapStats s;
+    s.size = size();
+    s.buckets = bucketCount();
+    s.loadFactor = loadFactor();
+    s.maxLoadFactor = maxLoad;
+    for (std::size_t b = 0; b < B.size(); b++) { // Walk every chain. 
+        int length = 0;
+        for (int j = B[b]; j >= 0; j = S[j].next) length++;
+        if (length >= int(s.chainHistogram.size())) s.chainHistogram.resize(length + 1, 0);
+        s.chainHistogram[length]++;
+        if (length > s.maxChain) s.maxChain = length;
+    }
+    probeStats.fill(s); // Operation counters (nothing with the NoStats policy). 
+    return s;
+}
+
+// resetStats() function implementation: 
+// Clears the counters of the statistics policy; the shape of the table is always measured afresh. 
+template <typename K, typename V, typename H, typename A, typename P>
+void HashMap<K, V, H, A, P>::resetStats() { probeStats.reset(); }
+
 // Explicit instantiation of the HashMap template for std::string keys, int values, and stringHash. 
 // This ensures that the code for this specific template specialization is generated,
 // allowing it to be used without linking errors when the template definition is in a .cpp file.
-template class HashMap<std::string, int, stringHash>; 
\ No newline at end of file
+template class HashMap<std::string, int, stringHash>; 
+template class HashMap<std::string, int, fastStringHash>;
+template class HashMap<std::string, int, stringHash, PoolAllocator<MapEntry<std::string, int> > >;
+template class HashMap<std::string, int, stringHash, std::allocator<MapEntry<std::string, int> >, ProbeStats>;
+template class HashMap<std::string, int, fastStringHash, std::allocator<MapEntry<std::string, int> >, ProbeStats>;
\ No newline at end of file
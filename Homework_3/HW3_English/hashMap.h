@@ -1,13 +1,63 @@
 #pragma once // Ensures this header file is included only once.
 
+#include <algorithm> // Includes std::min, used by parallelFor().
+#include <chrono>   // Includes std::chrono::steady_clock, used to time rehashes when statistics are collected.
+#include <cstdint>  // Includes std::uint64_t, used by fastStringHash.
+#include <cstring>  // Includes std::memcpy, used by fastStringHash to read unaligned words.
 #include <iostream> // Includes iostream for standard input/output operations.
-#include <list>     // Includes std::list, which will be used for buckets in the hash table.
-#include <vector>   // Includes std::vector, which will be used for the array of buckets.
+#include <iterator> // Includes std::distance, std::advance and std::iterator_traits, used by the bulk constructor.
+#include <memory>   // Includes std::allocator and std::allocator_traits.
+#include <string>   // Includes std::string, the key type of stringHash and fastStringHash.
+#include <string_view> // Includes std::string_view, used for lookups that do not construct a std::string.
+#include <thread>   // Includes std::thread, used by the bulk constructor to hash and link in parallel.
+#include <type_traits> // Includes std::void_t, used to detect heterogeneous lookup support.
+#include <utility>  // Includes std::move, std::forward, std::pair and std::in_place.
+#include <vector>   // Includes std::vector, which will be used for the entry array and the array of buckets.
+
+#include "hashStats.h" // Includes the statistics policies (NoStats, ProbeStats) and the HashMapStats snapshot.
+
+#if defined(_MSC_VER)
+#include <intrin.h> // Includes _umul128 (used by fastStringHash) and _mm_prefetch on MSVC.
+#endif
+
+// Hints the processor to start loading the cache line containing (p). It has no effect on program behavior; it only
+// lets the memory access overlap with other work. Used by the batched lookups of the hash maps.
+inline void prefetchRead(const void* p) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p, 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#else
+    (void)p;
+#endif
+}
+
+// Splits [0, n) into (threads) consecutive chunks of nearly equal size and calls f(c, lo, hi) for every chunk (c),
+// [lo, hi), each on its own thread (chunk 0 on the calling thread), then waits for all of them. With a single thread
+// it simply calls f(0, 0, n). Used by the bulk constructor of HashMap.
+template <typename F>
+void parallelFor(std::size_t n, int threads, F f) {
+    if (threads <= 1 || n <= 1) {
+        f(0, std::size_t(0), n);
+        return;
+    }
+    std::size_t step = (n + threads - 1) / threads;
+    std::vector<std::thread> pool;
+    for (std::size_t lo = step; lo < n; lo += step)
+        pool.emplace_back(f, int(lo / step), lo, std::min(n, lo + step));
+    f(0, std::size_t(0), std::min(n, step));
+    for (std::thread& t : pool) t.join();
+}
 
 // Defines a hash function structure for strings.
 struct stringHash {
+    // Declares that keys may be looked up as std::string_view: a std::string, a string literal or a const char*
+    // is hashed (and compared) without first being copied into a temporary std::string.
+    typedef std::string_view LookupKey;
+
     // Overloads the function call operator to allow the struct to be used like a function.
-    std::size_t operator()(const std::string& key) const {
+    // It is constexpr, so keys known at compile time can be hashed during compilation (see constexprHashMap.h).
+    constexpr std::size_t operator()(std::string_view key) const {
         std::size_t hash = 0; // Initializes a variable to store the hash value.
         for (char c : key) { // Iterates through each character in the input key.
             hash = (hash * 31) + c; // Calculates the hash value using a simple algorithm.
@@ -16,6 +66,99 @@ struct stringHash {
     }
 };
 
+// Defines a faster, higher-quality hash function structure for strings (a wyhash-style hash).
+// It consumes the key 8 or 16 bytes at a time and mixes them with 64x64->128 bit multiplications, so long keys
+// hash several times faster than with stringHash and every output bit depends on every input bit. That makes it
+// safe to use with the power-of-two bucket mode of HashMap, which only looks at the low bits of the hash.
+struct fastStringHash {
+    // Declares that keys may be looked up as std::string_view (see stringHash).
+    typedef std::string_view LookupKey;
+
+    // Overloads the function call operator to allow the struct to be used like a function.
+    std::size_t operator()(std::string_view key) const {
+        return std::size_t(hashBytes(key.data(), key.size()));
+    }
+
+    // Hashes (len) bytes starting at (p).
+    static std::uint64_t hashBytes(const char* p, std::size_t len) {
+        const std::uint64_t s0 = 0xa0761d6478bd642full, s1 = 0xe7037ed1a0b428dbull; // Mixing constants of wyhash. 
+        const std::uint64_t s2 = 0x8ebc6af09c88c6e3ull, s3 = 0x589965cc75374cc3ull;
+        std::uint64_t seed = mix(s0, s1); // Initial state. 
+        std::uint64_t a, b;               // The last (up to) 16 bytes of the key. 
+        if (len <= 16) {
+            if (len >= 4) {               // 4..16 bytes: two overlapping pairs of 4-byte reads cover the key. 
+                std::size_t mid = (len >> 3) << 2;
+                a = (read4(p) << 32) | read4(p + mid);
+                b = (read4(p + len - 4) << 32) | read4(p + len - 4 - mid);
+            } else if (len > 0) {         // 1..3 bytes: first, middle and last byte. 
+                a = (std::uint64_t((unsigned char)p[0]) << 16) | (std::uint64_t((unsigned char)p[len >> 1]) << 8)
+                    | (unsigned char)p[len - 1];
+                b = 0;
+            } else {
+                a = b = 0;
+            }
+        } else {
+            std::size_t i = len;
+            if (i > 48) {                 // Long keys: three independent lanes of 16 bytes each per round. 
+                std::uint64_t seed1 = seed, seed2 = seed;
+                do {
+                    seed = mix(read8(p) ^ s1, read8(p + 8) ^ seed);
+                    seed1 = mix(read8(p + 16) ^ s2, read8(p + 24) ^ seed1);
+                    seed2 = mix(read8(p + 32) ^ s3, read8(p + 40) ^ seed2);
+                    p += 48;
+                    i -= 48;
+                } while (i > 48);
+                seed ^= seed1 ^ seed2;
+            }
+            while (i > 16) {              // Remaining full 16-byte blocks. 
+                seed = mix(read8(p) ^ s1, read8(p + 8) ^ seed);
+                i -= 16;
+                p += 16;
+            }
+            a = read8(p + i - 16);        // The last 16 bytes (may overlap the previous block). 
+            b = read8(p + i - 8);
+        }
+        mul(a ^ s1, b ^ seed, a, b);      // Final avalanche. 
+        return mix(a ^ s0 ^ len, b ^ s1);
+    }
+
+private:
+    // Computes the full 128-bit product of (x) and (y) as (lo, hi).
+    static void mul(std::uint64_t x, std::uint64_t y, std::uint64_t& lo, std::uint64_t& hi) {
+#if defined(__SIZEOF_INT128__)
+        unsigned __int128 r = (unsigned __int128)x * y;
+        lo = std::uint64_t(r);
+        hi = std::uint64_t(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        lo = _umul128(x, y, &hi);
+#else
+        std::uint64_t xl = x & 0xffffffffull, xh = x >> 32, yl = y & 0xffffffffull, yh = y >> 32;
+        std::uint64_t ll = xl * yl, lh = xl * yh, hl = xh * yl, hh = xh * yh;
+        std::uint64_t mid = (ll >> 32) + (lh & 0xffffffffull) + (hl & 0xffffffffull);
+        lo = (mid << 32) | (ll & 0xffffffffull);
+        hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+    }
+    // Multiplies (x) and (y) and folds the 128-bit product into 64 bits.
+    static std::uint64_t mix(std::uint64_t x, std::uint64_t y) {
+        std::uint64_t lo, hi;
+        mul(x, y, lo, hi);
+        return lo ^ hi;
+    }
+    // Reads 8 (possibly unaligned) bytes. 
+    static std::uint64_t read8(const char* p) { std::uint64_t v; std::memcpy(&v, p, 8); return v; }
+    // Reads 4 (possibly unaligned) bytes. 
+    static std::uint64_t read4(const char* p) { std::uint32_t v; std::memcpy(&v, p, 4); return v; }
+};
+
+// Selects the type taken by find() and erase(): H::LookupKey if the hash function declares one (heterogeneous
+// lookup), otherwise the key type K itself.
+template <typename K, typename H, typename = void>
+struct LookupKeyOf { typedef K type; };
+
+template <typename K, typename H>
+struct LookupKeyOf<K, H, std::void_t<typename H::LookupKey> > { typedef typename H::LookupKey type; };
+
 // Template class Entry to store a key-value pair.
 template <typename K, typename V>
 class Entry {
@@ -24,6 +167,12 @@ public:
     Entry(const K& k = K(), const V& v = V())
         : _key(k), _value(v) { } // Uses a member initializer list to initialize _key and _value.
 
+    // In-place constructor: Initializes the key from (k) and constructs the value directly from (args),
+    // forwarding rvalues so nothing is copied that can be moved. The std::in_place tag selects this constructor.
+    template <typename KK, typename... Args>
+    Entry(std::in_place_t, KK&& k, Args&&... args)
+        : _key(std::forward<KK>(k)), _value(std::forward<Args>(args)...) { }
+
     // Constant member function to return the key.
     const K& key() const { return _key; }
 
@@ -36,23 +185,63 @@ public:
     // Member function to set the value.
     void setValue(const V& v) { _value = v; }
 
+    // Member function to set the value by moving (v) into the entry.
+    void setValue(V&& v) { _value = std::move(v); }
+
 private:
     K _key;   // Member variable to store the key of the Entry.
     V _value; // Member variable to store the value of the Entry.
 };
 
-// Template class HashMap. Takes key type (K), value type (V), and hash function type (H).
-template <typename K, typename V, typename H>
+// Template class MapEntry. The (key,value) pair stored by the hash maps. Unlike Entry<const K, V>, its key is not
+// const, so moving an entry (when a table grows, or an erase fills a hole) moves the key instead of copying it.
+// The key can still only be read: setKey() is not available, since a changed key would be in the wrong place.
+template <typename K, typename V>
+class MapEntry : public Entry<K, V> {
+public:
+    using Entry<K, V>::Entry;
+    void setKey(const K& k) = delete;
+};
+
+// Tells the bulk constructor of HashMap whether the keys of its range may repeat.
+enum class BulkKeys {
+    Check,  // Keys may repeat; each one is looked up, and a repeated key keeps the value of its last pair, as with put(). 
+    Unique  // The caller guarantees that no key repeats; the pairs are added without any lookup. 
+};
+
+// Template class HashMap. Takes key type (K), value type (V), hash function type (H), and the allocator type (A)
+// used for its arrays. A defaults to std::allocator and is rebound to allocate the entry array and the bucket array;
+// PoolAllocator (poolAllocator.h) recycles those arrays through a pool shared with other maps built from its copies.
+// The entries live in one dense array, in insertion order, so iterating over the map is a sequential sweep of that
+// array. The buckets only hold the index of the first entry of their chain; each entry stores the index of the next
+// entry in its chain and the hash of its key, so chains are walked (and rehashed) without calling the hash function.
+// The statistics policy (P) decides what the map records about its own behavior: NoStats (the default) records
+// nothing at no cost, ProbeStats counts probes and rehashes (see hashStats.h and stats()).
+template <typename K, typename V, typename H, typename A = std::allocator< ::MapEntry<K, V> >, typename P = NoStats>
 class HashMap {
 public:
-    typedef Entry<const K, V> Entry; // Defines Entry type to represent a (key,value) pair. 
+    typedef ::MapEntry<K, V> Entry; // Defines Entry type to represent a (key,value) pair; its key is read-only. 
+    typedef typename LookupKeyOf<K, H>::type LookupKey; // Type accepted by find() and erase(k), e.g. std::string_view for stringHash. 
 
     // Declaration of the inner Iterator class for HashMap. 
     class Iterator;
 
 public:
     // Constructor: Sets the initial capacity of the hash map's buckets. Default is 100. 
-    HashMap(int capacity = 100);
+    // If (powerOfTwo) is true, the bucket count is kept at a power of two and a bucket is selected by masking the 
+    // hash instead of the slower integer modulo. Use it with a hash whose low bits are well mixed (e.g. fastStringHash). 
+    // The entry array and the bucket array are allocated through copies of (alloc), rebound to their element types. 
+    HashMap(int capacity = 100, bool powerOfTwo = false, const A& alloc = A());
+
+    // Bulk constructor: Builds the map from the (key, value) pairs in [first, last), e.g. std::pair<K, V> or the 
+    // elements of a std::map, in one linear pass whether or not the range is sorted. The range is counted first, so 
+    // both arrays are sized once and nothing is ever rehashed or moved, and every key is hashed exactly once. 
+    // With BulkKeys::Check repeated keys are allowed (the last value wins); with BulkKeys::Unique no key is looked up 
+    // and the entries are linked into their buckets only after all of them are stored. (threads) > 1 hashes the keys 
+    // on that many threads and, with BulkKeys::Unique, also links them: each thread owns a range of buckets, so no two 
+    // threads write to the same bucket. The iterators must be forward iterators (the range is read twice). 
+    template <typename It, typename = typename std::iterator_traits<It>::iterator_category>
+    HashMap(It first, It last, BulkKeys keys = BulkKeys::Check, int threads = 1, bool powerOfTwo = false, const A& alloc = A());
 
     // Returns the number of entries (key-value pairs) currently stored in the hash map. 
     int size() const;
@@ -60,16 +249,70 @@ public:
     // Returns true if the map is empty. 
     bool empty() const;
 
+    // Returns the number of buckets in the bucket array. 
+    int bucketCount() const;
+
+    // Returns the current load factor, i.e. the average number of entries per bucket. 
+    float loadFactor() const;
+
+    // Returns the load factor above which put() grows the bucket array. 
+    float maxLoadFactor() const;
+
+    // Sets the maximum load factor (f > 0) and rehashes right away if it is already exceeded. 
+    void setMaxLoadFactor(float f);
+
+    // Makes room for at least (count) entries without exceeding the maximum load factor. 
+    void reserve(int count);
+
+    // Redistributes all entries into a bucket array with (at least) the given number of buckets. 
+    // Entries keep their positions in the entry array, so iterators stay valid. 
+    void rehash(int buckets);
+
     // Finds an entry with key k and returns an iterator to it. 
-    Iterator find(const K& k);
+    Iterator find(const LookupKey& k);
 
     // Inserts or replaces a (k,v) pair in the map. 
     Iterator put(const K& k, const V& v);
 
+    // Inserts or replaces a (k,v) pair in the map, moving the key and the value in instead of copying them. 
+    Iterator put(K&& k, V&& v);
+
+    // Constructs an entry in place from (args) (a key followed by the value's constructor arguments) and inserts it 
+    // unless its key is already present, in which case the new entry is discarded. 
+    // Returns the position of the entry with that key and whether an insertion took place. 
+    template <typename... Args>
+    std::pair<Iterator, bool> emplace(Args&&... args);
+
+    // Inserts an entry with key k whose value is constructed in place from (args), unless key k is already present. 
+    // Unlike emplace(), nothing is constructed (and no argument is moved from) if the key exists. 
+    template <typename... Args>
+    std::pair<Iterator, bool> try_emplace(const K& k, Args&&... args);
+    template <typename... Args>
+    std::pair<Iterator, bool> try_emplace(K&& k, Args&&... args);
+
+    // Assigns (v) to the entry with key k, or inserts a new (k,v) entry if key k is absent. 
+    // Returns the position of the entry and whether an insertion took place. 
+    template <typename M>
+    std::pair<Iterator, bool> insert_or_assign(const K& k, M&& v);
+    template <typename M>
+    std::pair<Iterator, bool> insert_or_assign(K&& k, M&& v);
+
+    // Looks up every key in [first, last) and writes its position (or end()) to (out), in order. 
+    // Keys are processed in batches: all keys of a batch are hashed and their buckets prefetched before any of them is 
+    // searched, so the cache misses of different keys overlap instead of being paid one after another. 
+    template <typename KeyIt, typename OutIt>
+    OutIt findMany(KeyIt first, KeyIt last, OutIt out);
+
+    // Inserts or replaces the pairs (*first, *values), (*(first+1), *(values+1)), ... for every key in [first, last). 
+    // Room for all of them is reserved up front and the buckets are prefetched in batches like findMany(). 
+    template <typename KeyIt, typename ValIt>
+    void putMany(KeyIt first, KeyIt last, ValIt values);
+
     // Removes an entry with key k. 
-    void erase(const K& k);
+    void erase(const LookupKey& k);
 
-    // Erases the entry at position p. 
+    // Erases the entry at position p. The last entry of the map is moved into position p to keep the entry array 
+    // dense, so an iterator at p now refers to that entry, and iterators to the last entry are invalidated. 
     void erase(const Iterator& p);
 
     // Returns an iterator to the first entry in the map. 
@@ -78,41 +321,67 @@ public:
     // Returns an iterator to the end entry (past-the-end) of the map. 
     Iterator end();
 
+    // Returns a snapshot of the table's shape (load factor, bucket chain lengths) and, with the ProbeStats policy, of
+    // the probe lengths of every find, insert and erase and of the time spent rehashing. Walks every bucket. 
+    HashMapStats stats() const;
+
+    // Clears the counters of the statistics policy. 
+    void resetStats();
+
 protected:
-    typedef std::list<Entry> Bucket;     // Defines 'Bucket' as a list to hold entries. 
-    typedef std::vector<Bucket> BktArray; // Defines 'BktArray' as a vector to hold buckets. 
+    // An element of the entry array: the entry itself, the hash of its key, and the index of the next entry in the 
+    // same bucket (-1 at the end of the chain). 
+    struct Slot {
+        template <typename... Args>
+        Slot(std::size_t h, Args&&... args) : entry(std::forward<Args>(args)...), hash(h), next(-1) { }
 
-    // Utility functions for HashMap operations. 
-    Iterator finder(const K& k);                     // Internal utility function to find a given key (k). 
-    Iterator inserter(const Iterator& p, const Entry& e); // Internal utility function to insert an entry (e) before position (p). 
-    void eraser(const Iterator& p);                   // Internal utility function to remove the entry pointed to by iterator (p). 
+        Entry entry;      // The (key,value) pair. 
+        std::size_t hash; // The hash value of entry.key(). 
+        int next;         // Index of the next entry in the bucket chain, or -1. 
+    };
 
-    typedef typename BktArray::iterator Bltor; // Defines Bltor as an iterator type for the bucket array. 
-    typedef typename Bucket::iterator Eltor;   // Defines Eltor as an iterator type for a bucket (list). 
+    typedef typename std::allocator_traits<A>::template rebind_alloc<Slot> SlotAlloc; // A, rebound to allocate slots. 
+    typedef typename std::allocator_traits<A>::template rebind_alloc<int> HeadAlloc;  // A, rebound to allocate bucket heads. 
+    typedef std::vector<Slot, SlotAlloc> SlotArray; // Defines 'SlotArray' as the dense array holding the entries. 
+    typedef std::vector<int, HeadAlloc> BktArray;   // Defines 'BktArray' as a vector holding the first entry of each bucket (-1 if empty). 
 
-    // Static utility function to advance an iterator (p) to the next entry within a bucket. 
-    static void nextEntry(Iterator& p) { ++p.ent; }
-    // Static utility function to check if an iterator (p) has reached the end of its current bucket. 
-    static bool endOfBkt(const Iterator& p) { return p.ent == p.bkt->end(); }
+    // Utility functions for HashMap operations. 
+    int finder(const LookupKey& k, std::size_t h, StatOp op) const; // Internal utility function returning the index of key (k) with hash (h), or -1. 
+    int finderIn(std::size_t i, const LookupKey& k, std::size_t h, StatOp op) const; // Internal utility function searching bucket (i) for key (k). 
+    std::size_t bucketOf(std::size_t h) const;       // Internal utility function mapping a hash value (h) to a bucket index. 
+    void link(int i);                                // Internal utility function adding entry (i) to the chain of its bucket. 
+    void reserveSlots(std::size_t count);            // Internal utility function growing the capacity of S, moving the entries. 
+    template <typename... Args>
+    void append(Args&&... args);                     // Internal utility function constructing a slot from (args) at the end of S. 
+    Iterator adopt();                                // Internal utility function making the last entry of S reachable. 
+    template <typename... Args>
+    Iterator emplacer(std::size_t h, Args&&... args); // Internal utility function constructing an entry with hash (h) from (args). 
+    void eraser(int i);                              // Internal utility function to remove entry (i). 
+    void linkAll(int threads);                       // Internal utility function linking every entry into empty buckets. 
+
+    static constexpr int BATCH = 16; // Number of keys whose memory accesses findMany() and putMany() overlap. 
+    static constexpr int LINK_GRAIN = 4096; // Entries per thread below which linkAll() does not start threads. 
 
 private:
-    int n;          // The number of entries currently stored in the hash map. 
+    float maxLoad;  // The maximum load factor (S.size() / B.size()) tolerated before the bucket array grows. 
+    bool pow2;      // True if B.size() is kept at a power of two and buckets are selected with a mask. 
     H hash;         // The hash function object used to compare keys. 
-    BktArray B;     // The bucket array where the actual data is stored. 
+    SlotArray S;    // The entry array where the actual data is stored, without gaps. 
+    BktArray B;     // The bucket array, holding the head of every bucket chain. 
+    mutable P probeStats; // The statistics policy; lookups (which are const) record their probes in it. 
 
 public:
     // Definition of the HashMap::Iterator class. 
     class Iterator {
     private:
-        Eltor ent;             // The position of the entry within its bucket. 
-        Bltor bkt;             // The position of the bucket within the bucket array. 
-        const BktArray* ba;    // A pointer to the bucket array this iterator belongs to. 
+        int idx;        // The position of the entry within the entry array. 
+        SlotArray* sa;  // A pointer to the entry array this iterator belongs to. 
 
     public:
-        // Iterator constructor: Initializes the iterator with references to the bucket array (a),
-        // bucket position (b), and entry position (q). 
-        Iterator(const BktArray& a, const Bltor& b, const Eltor& q = Eltor())
-            : ent(q), bkt(b), ba(&a) { }
+        // Iterator constructor: Initializes the iterator with a reference to the entry array (a) and the position (i) 
+        // of an entry in it; a position equal to the number of entries is the end of the map. 
+        Iterator(SlotArray& a, int i)
+            : idx(i), sa(&a) { }
 
         // Overloads the dereference operator to return a reference to the Entry pointed to by the iterator. 
         Entry& operator*() const;
@@ -123,4 +392,181 @@ public:
 
         friend class HashMap; // Grants the HashMap class access to the private members of Iterator. 
     };
-};
\ No newline at end of file
+};
+
+// Member template definitions. 
+// Unlike the other members, these cannot be explicitly instantiated in hashMap.cpp for every argument list, 
+// so they are defined here where callers can see them. 
+
+// Bulk constructor implementation: 
+// Hashes every key of the range (in parallel if asked to), sizes the map for all of them, then stores the pairs in 
+// range order. Checked keys are looked up (the bucket of a later key is prefetched BATCH pairs ahead, since its hash 
+// is already known) and linked one by one; unique keys are stored without a lookup and linked by linkAll(). 
+template <typename K, typename V, typename H, typename A, typename P>
+template <typename It, typename>
+HashMap<K, V, H, A, P>::HashMap(It first, It last, BulkKeys keys, int threads, bool powerOfTwo, const A& alloc)
+    : HashMap(1, powerOfTwo, alloc) {
+    std::size_t count = std::size_t(std::distance(first, last));
+    std::vector<std::size_t> hs(count);              // Hash value of every key, in range order. 
+    parallelFor(count, threads, [&](int, std::size_t lo, std::size_t hi) {
+        It it = first;
+        std::advance(it, lo);
+        for (std::size_t j = lo; j < hi; j++, ++it) hs[j] = hash((*it).first);
+    });
+    reserve(int(count));                             // The only allocation of both arrays; the map is still empty. 
+    if (keys == BulkKeys::Unique) {                  // Trusted keys: store them all, then link them all. 
+        for (std::size_t j = 0; j < count; j++, ++first) append(hs[j], std::in_place, (*first).first, (*first).second);
+        linkAll(threads);
+        return;
+    }
+    for (std::size_t j = 0; j < count; j++, ++first) { // Checked keys: look every key up before storing it. 
+        if (j + BATCH < count) prefetchRead(&B[bucketOf(hs[j + BATCH])]);
+        int i = finder((*first).first, hs[j], StatOp::Insert);
+        if (i >= 0) {                                // A repeated key: the later value replaces the earlier one. 
+            S[i].entry.setValue((*first).second);
+            continue;
+        }
+        append(hs[j], std::in_place, (*first).first, (*first).second); // Room was reserved above, 
+        link(size() - 1);                            // and the bucket array is already large enough. 
+    }
+}
+
+// append() function implementation: 
+// Constructs a slot from (args) at the end of S. When S is full, std::vector moves the entries into the larger array: 
+// the key of an Entry is not const, so they are moved whenever the moves of K and V cannot throw (as for std::string).
+template <typename K, typename V, typename H, typename A, typename P>
+template <typename... Args>
+void HashMap<K, V, H, A, P>::append(Args&&... args) {
+    S.emplace_back(std::forward<Args>(args)...);
+}
+
+// emplacer() function implementation: 
+// Constructs a new entry with key hash (h) from (args) directly at the end of the entry array and links it. 
+template <typename K, typename V, typename H, typename A, typename P>
+template <typename... Args>
+typename HashMap<K, V, H, A, P>::Iterator HashMap<K, V, H, A, P>::emplacer(std::size_t h, Args&&... args) {
+    append(h, std::forward<Args>(args)...); // Build the entry in its slot. 
+    return adopt(); // Link it into its bucket (growing the bucket array if needed) and return its position. 
+}
+
+// emplace() function implementation: 
+// The key is only known once the entry exists, so the entry is first built at the end of the entry array and only 
+// linked into its bucket if the key is new. The entry is constructed exactly once and never copied. 
+template <typename K, typename V, typename H, typename A, typename P>
+template <typename... Args>
+std::pair<typename HashMap<K, V, H, A, P>::Iterator, bool> HashMap<K, V, H, A, P>::emplace(Args&&... args) {
+    append(0, std::in_place, std::forward<Args>(args)...); // Construct the entry in place. 
+    Slot& s = S.back();
+    s.hash = hash(s.entry.key());                       // Its hash is only known now. 
+    int i = finder(s.entry.key(), s.hash, StatOp::Insert); // Look for an entry with the same key (the new one is not linked yet). 
+    if (i >= 0) {                                       // If the key already exists, 
+        S.pop_back();                                   // discard the new entry and keep the old one. 
+        return std::pair<Iterator, bool>(Iterator(S, i), false);
+    }
+    return std::pair<Iterator, bool>(adopt(), true);    // Otherwise link the new entry into its bucket. 
+}
+
+// try_emplace(const K&, ...) function implementation: 
+// Constructs the value from (args) only if key (k) is absent. 
+template <typename K, typename V, typename H, typename A, typename P>
+template <typename... Args>
+std::pair<typename HashMap<K, V, H, A, P>::Iterator, bool> HashMap<K, V, H, A, P>::try_emplace(const K& k, Args&&... args) {
+    std::size_t h = hash(k);                            // Hash key (k) once. 
+    int i = finder(k, h, StatOp::Insert);               // Search for key (k). 
+    if (i >= 0) return std::pair<Iterator, bool>(Iterator(S, i), false); // Present: leave the entry (and args) alone. 
+    return std::pair<Iterator, bool>(emplacer(h, std::in_place, k, std::forward<Args>(args)...), true);
+}
+
+// try_emplace(K&&, ...) function implementation: 
+// Same as above, but moves key (k) into the new entry. 
+template <typename K, typename V, typename H, typename A, typename P>
+template <typename... Args>
+std::pair<typename HashMap<K, V, H, A, P>::Iterator, bool> HashMap<K, V, H, A, P>::try_emplace(K&& k, Args&&... args) {
+    std::size_t h = hash(k);                            // Hash key (k) once. 
+    int i = finder(k, h, StatOp::Insert);               // Search for key (k). 
+    if (i >= 0) return std::pair<Iterator, bool>(Iterator(S, i), false); // Present: leave the entry (and args) alone. 
+    return std::pair<Iterator, bool>(emplacer(h, std::in_place, std::move(k), std::forward<Args>(args)...), true);
+}
+
+// insert_or_assign(const K&, M&&) function implementation: 
+// Assigns (v) to an existing entry, or constructs a new entry from (k) and (v). 
+template <typename K, typename V, typename H, typename A, typename P>
+template <typename M>
+std::pair<typename HashMap<K, V, H, A, P>::Iterator, bool> HashMap<K, V, H, A, P>::insert_or_assign(const K& k, M&& v) {
+    std::size_t h = hash(k);                            // Hash key (k) once. 
+    int i = finder(k, h, StatOp::Insert);               // Search for key (k). 
+    if (i >= 0) {                                       // Present: assign the new value. 
+        S[i].entry.setValue(std::forward<M>(v));
+        return std::pair<Iterator, bool>(Iterator(S, i), false);
+    }
+    return std::pair<Iterator, bool>(emplacer(h, std::in_place, k, std::forward<M>(v)), true);
+}
+
+// insert_or_assign(K&&, M&&) function implementation: 
+// Same as above, but moves key (k) into a new entry. 
+template <typename K, typename V, typename H, typename A, typename P>
+template <typename M>
+std::pair<typename HashMap<K, V, H, A, P>::Iterator, bool> HashMap<K, V, H, A, P>::insert_or_assign(K&& k, M&& v) {
+    std::size_t h = hash(k);                            // Hash key (k) once. 
+    int i = finder(k, h, StatOp::Insert);               // Search for key (k). 
+    if (i >= 0) {                                       // Present: assign the new value. 
+        S[i].entry.setValue(std::forward<M>(v));
+        return std::pair<Iterator, bool>(Iterator(S, i), false);
+    }
+    return std::pair<Iterator, bool>(emplacer(h, std::in_place, std::move(k), std::forward<M>(v)), true);
+}
+
+// findMany() function implementation: 
+// Works in three passes over each batch: (1) hash every key and prefetch its bucket head, (2) prefetch the first 
+// entry of every non-empty bucket, whose index is only known once the head has arrived, (3) search the buckets. 
+template <typename K, typename V, typename H, typename A, typename P>
+template <typename KeyIt, typename OutIt>
+OutIt HashMap<K, V, H, A, P>::findMany(KeyIt first, KeyIt last, OutIt out) {
+    std::size_t hs[BATCH];                        // Hash value of every key in the current batch. 
+    std::size_t idx[BATCH];                       // Bucket index of every key in the current batch. 
+    while (first != last) {
+        KeyIt start = first;                      // First key of this batch. 
+        int m = 0;                                // Number of keys in this batch. 
+        for (; m < BATCH && first != last; ++m, ++first) { // Pass 1: hash and prefetch the bucket heads. 
+            hs[m] = hash(*first);
+            idx[m] = bucketOf(hs[m]);
+            prefetchRead(&B[idx[m]]);
+        }
+        for (int j = 0; j < m; j++)               // Pass 2: prefetch the first entry of every bucket. 
+            if (B[idx[j]] >= 0) prefetchRead(&S[B[idx[j]]]);
+        for (int j = 0; j < m; j++, ++start) {    // Pass 3: search, with the data (usually) in cache. 
+            int i = finderIn(idx[j], *start, hs[j], StatOp::Find);
+            *out = i < 0 ? end() : Iterator(S, i);
+            ++out;
+        }
+    }
+    return out;
+}
+
+// putMany() function implementation: 
+// Reserves room for every key first, so the bucket indices computed for a batch stay valid while it is inserted. 
+template <typename K, typename V, typename H, typename A, typename P>
+template <typename KeyIt, typename ValIt>
+void HashMap<K, V, H, A, P>::putMany(KeyIt first, KeyIt last, ValIt values) {
+    int count = 0;                                // Count the keys (without consuming them) to reserve room. 
+    for (KeyIt it = first; it != last; ++it) count++;
+    reserve(size() + count);
+    std::size_t hs[BATCH];                        // Hash value of every key in the current batch. 
+    std::size_t idx[BATCH];                       // Bucket index of every key in the current batch. 
+    while (first != last) {
+        KeyIt start = first;                      // First key of this batch. 
+        int m = 0;                                // Number of keys in this batch. 
+        for (; m < BATCH && first != last; ++m, ++first) { // Pass 1: hash and prefetch the bucket heads. 
+            hs[m] = hash(*first);
+            idx[m] = bucketOf(hs[m]);
+            prefetchRead(&B[idx[m]]);
+        }
+        for (int j = 0; j < m; j++)               // Pass 2: prefetch the first entry of every bucket. 
+            if (B[idx[j]] >= 0) prefetchRead(&S[B[idx[j]]]);
+        for (int j = 0; j < m; j++, ++start, ++values) { // Pass 3: insert or assign. 
+            int i = finderIn(idx[j], *start, hs[j], StatOp::Insert);
+            if (i >= 0) S[i].entry.setValue(*values);    // Existing key: replace the value. 
+            else emplacer(hs[j], std::in_place, *start, *values); // New key: room was reserved above. 
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include "hashStats.h" // Includes the definitions of HashMapStats and the statistics policies.
+
+#include <sstream> // Includes std::ostringstream, used to build the JSON text.
+
+// Writes the numbers of (v) to (out) as a JSON array.
+static void writeArray(std::ostringstream& out, const std::vector<std::uint64_t>& v) {
+    out << '[';
+    for (std::size_t i = 0; i < v.size(); i++)
+        out << (i ? "," : "") << v[i];
+    out << ']';
+}
+
+// Writes the counters of one operation kind (o) to (out) as a JSON object.
+static void writeOp(std::ostringstream& out, const HashMapStats::OpStats& o) {
+    out << "{\"count\":" << o.count << ",\"probes\":" << o.probes << ",\"meanProbe\":" << o.meanProbe()
+        << ",\"maxProbe\":" << o.maxProbe << '}';
+}
+
+// HashMapStats::toJson() function implementation: 
+// Writes the shape of the table and, if present, the operation counters. Every value is a number, a boolean or an 
+// array of numbers, so nothing needs escaping.
+std::string HashMapStats::toJson() const {
+    std::ostringstream out;
+    out << "{\"size\":" << size << ",\"buckets\":" << buckets << ",\"loadFactor\":" << loadFactor
+        << ",\"maxLoadFactor\":" << maxLoadFactor << ",\"maxChain\":" << maxChain << ",\"chainHistogram\":";
+    writeArray(out, chainHistogram);
+    out << ",\"instrumented\":" << (instrumented ? "true" : "false");
+    if (instrumented) {                    // Counters are only meaningful if a policy recorded them. 
+        out << ",\"find\":";
+        writeOp(out, find);
+        out << ",\"insert\":";
+        writeOp(out, insert);
+        out << ",\"erase\":";
+        writeOp(out, erase);
+        out << ",\"probeHistogram\":";
+        writeArray(out, probeHistogram);
+        out << ",\"rehashes\":" << rehashes << ",\"rehashNanos\":" << rehashNanos;
+    }
+    out << '}';
+    return out.str();
+}
+
+// ProbeStats constructor implementation: 
+// Clears every counter. 
+ProbeStats::ProbeStats() { reset(); }
+
+// fill() function implementation: 
+// Copies the operation counters, the probe histogram and the rehash counters into (s). 
+void ProbeStats::fill(HashMapStats& s) const {
+    s.instrumented = true;
+    s.find = ops[int(StatOp::Find)];
+    s.insert = ops[int(StatOp::Insert)];
+    s.erase = ops[int(StatOp::Erase)];
+    s.probeHistogram.assign(hist, hist + HISTOGRAM);
+    s.rehashes = rehashes;
+    s.rehashNanos = rehashNanos;
+}
+
+// reset() function implementation: 
+// Sets every counter back to zero. 
+void ProbeStats::reset() {
+    for (int i = 0; i < 3; i++) ops[i] = Counter();
+    for (int i = 0; i < HISTOGRAM; i++) hist[i] = 0;
+    rehashes = rehashNanos = 0;
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+#pragma once // Ensures this header file is included only once.
+
+#include <cstdint> // Includes std::uint64_t, the type of every counter.
+#include <string>  // Includes std::string, returned by HashMapStats::toJson().
+#include <vector>  // Includes std::vector, which holds the histograms.
+
+// The kinds of operation whose probes a statistics policy records.
+enum class StatOp { Find = 0, Insert = 1, Erase = 2 };
+
+// Struct HashMapStats. A snapshot of the shape of a HashMap and, if it was built with the ProbeStats policy, of the
+// work its operations did. Returned by HashMap::stats(); the map can keep changing after the snapshot is taken.
+struct HashMapStats {
+    // Counters of one kind of operation (see StatOp). 
+    struct OpStats {
+        std::uint64_t count = 0;    // Number of operations. 
+        std::uint64_t probes = 0;   // Total number of entries compared by them. 
+        std::uint64_t maxProbe = 0; // Largest number of entries compared by a single operation. 
+
+        // Returns the average number of entries compared per operation. 
+        double meanProbe() const { return count ? double(probes) / count : 0.0; }
+    };
+
+    // Shape of the table, computed when the snapshot is taken. 
+    int size = 0;                          // Number of entries. 
+    int buckets = 0;                       // Number of buckets. 
+    float loadFactor = 0;                  // size / buckets. 
+    float maxLoadFactor = 0;               // Load factor above which the bucket array grows. 
+    int maxChain = 0;                      // Length of the longest bucket chain. 
+    std::vector<std::uint64_t> chainHistogram; // chainHistogram[i] is the number of buckets holding i entries. 
+
+    // Operation counters, only filled in by the ProbeStats policy. 
+    bool instrumented = false;             // True if the counters below were recorded. 
+    OpStats find, insert, erase;           // Per-operation probe counts; put() and friends count as inserts. 
+    std::vector<std::uint64_t> probeHistogram; // probeHistogram[i] is the number of operations that compared i entries (the last bucket collects the rest). 
+    std::uint64_t rehashes = 0;            // Number of times the bucket array was rebuilt. 
+    std::uint64_t rehashNanos = 0;         // Time spent rebuilding it, in nanoseconds. 
+
+    // Returns the snapshot as a single JSON object. 
+    std::string toJson() const;
+};
+
+// Class NoStats. The default statistics policy of HashMap: records nothing, so every hook compiles away.
+class NoStats {
+public:
+    static constexpr bool enabled = false; // Tells HashMap not to read the clock around a rehash. 
+
+    void probe(StatOp, int) { }            // Called once per lookup with the number of entries compared. 
+    void rehash(std::uint64_t) { }         // Called once per rehash with its duration in nanoseconds. 
+    void fill(HashMapStats&) const { }     // Copies the counters into a snapshot. 
+    void reset() { }                       // Clears the counters. 
+};
+
+// Class ProbeStats. A statistics policy that counts every lookup, the entries it compared, and every rehash.
+// It costs a few additions per operation, so it is meant for diagnosing a map (e.g. a hash function that puts
+// many keys into the same bucket), not for every map in production. Like the map itself it is not thread-safe.
+class ProbeStats {
+public:
+    static constexpr bool enabled = true;  // Tells HashMap to time every rehash. 
+    static constexpr int HISTOGRAM = 17;   // Probe lengths 0..15 are counted separately, longer ones together. 
+
+    // Constructor: Starts with every counter at zero. 
+    ProbeStats();
+
+    // Records one operation of kind (op) that compared (length) entries. Defined here so that it is inlined. 
+    void probe(StatOp op, int length) {
+        Counter& c = ops[int(op)];
+        c.count++;
+        c.probes += length;
+        if (std::uint64_t(length) > c.maxProbe) c.maxProbe = length;
+        hist[length < HISTOGRAM - 1 ? length : HISTOGRAM - 1]++;
+    }
+    // Records one rehash that took (nanos) nanoseconds. 
+    void rehash(std::uint64_t nanos) { rehashes++; rehashNanos += nanos; }
+    // Copies the counters into the snapshot (s). 
+    void fill(HashMapStats& s) const;
+    // Clears every counter. 
+    void reset();
+
+private:
+    typedef HashMapStats::OpStats Counter;
+    Counter ops[3];                        // Counters of every StatOp. 
+    std::uint64_t hist[HISTOGRAM];         // Histogram of probe lengths over all operations. 
+    std::uint64_t rehashes;                // Number of rehashes. 
+    std::uint64_t rehashNanos;             // Total duration of the rehashes. 
+};
\ No newline at end of file
@@ -0,0 +1,155 @@
+#include "lockFreeHashMap.h" // Includes the definition of the LockFreeHashMap class.
+
+// Table constructor implementation: 
+// Allocates (buckets) empty buckets. 
+template <typename K, typename V, typename H>
+LockFreeHashMap<K, V, H>::Table::Table(int buckets) : size(buckets), heads(new std::atomic<Node*>[buckets]) {
+    for (int b = 0; b < size; b++) heads[b].store(nullptr, std::memory_order_relaxed);
+}
+
+// Table destructor implementation: 
+// Frees every node of every bucket and the bucket array itself. 
+template <typename K, typename V, typename H>
+LockFreeHashMap<K, V, H>::Table::~Table() {
+    for (int b = 0; b < size; b++) {
+        Node* x = heads[b].load(std::memory_order_relaxed);
+        while (x != nullptr) {
+            Node* nx = x->next.load(std::memory_order_relaxed);
+            delete x;
+            x = nx;
+        }
+    }
+    delete[] heads;
+}
+
+// deleteNode() function implementation: 
+// Frees a single retired node. 
+template <typename K, typename V, typename H>
+void LockFreeHashMap<K, V, H>::deleteNode(void* p) { delete static_cast<Node*>(p); }
+
+// deleteTable() function implementation: 
+// Frees a retired table together with the nodes still linked into it. 
+template <typename K, typename V, typename H>
+void LockFreeHashMap<K, V, H>::deleteTable(void* p) { delete static_cast<Table*>(p); }
+
+// LockFreeHashMap constructor implementation: 
+// Publishes an empty table with (capacity) buckets. 
+template <typename K, typename V, typename H>
+LockFreeHashMap<K, V, H>::LockFreeHashMap(int capacity)
+    : table(new Table(capacity > 0 ? capacity : 1)), n(0), retired(EpochDomain::global()) { }
+
+// LockFreeHashMap destructor implementation: 
+// Frees the current table; retired nodes and tables are freed by the RetireList destructor. 
+template <typename K, typename V, typename H>
+LockFreeHashMap<K, V, H>::~LockFreeHashMap() { delete table.load(std::memory_order_relaxed); }
+
+// size() function implementation: 
+// Returns the number of entries. 
+template <typename K, typename V, typename H>
+int LockFreeHashMap<K, V, H>::size() const { return n.load(std::memory_order_relaxed); }
+
+// empty() function implementation: 
+// Checks if the number of entries is 0. 
+template <typename K, typename V, typename H>
+bool LockFreeHashMap<K, V, H>::empty() const { return size() == 0; }
+
+// finder() function implementation: 
+// Walks the chain of key (k) in the current table. The caller must be inside an epoch. 
+template <typename K, typename V, typename H>
+const typename LockFreeHashMap<K, V, H>::Node* LockFreeHashMap<K, V, H>::finder(const LookupKey& k) const {
+    std::size_t h = hash(k);                             // Hash of the key. 
+    Table* t = table.load(std::memory_order_acquire);    // The table current at this moment. 
+    Node* x = t->heads[h % t->size].load(std::memory_order_acquire);
+    while (x != nullptr && (x->hash != h || x->key != k)) // Compare the cached hash before the key. 
+        x = x->next.load(std::memory_order_acquire);
+    return x;
+}
+
+// find() function implementation: 
+// Copies the value out while the epoch keeps the node alive. 
+template <typename K, typename V, typename H>
+bool LockFreeHashMap<K, V, H>::find(const LookupKey& k, V& v) const {
+    EpochGuard guard(EpochDomain::global());
+    const Node* x = finder(k);
+    if (x == nullptr) return false;
+    v = x->value;
+    return true;
+}
+
+// contains() function implementation: 
+// Checks for key (k) inside an epoch. 
+template <typename K, typename V, typename H>
+bool LockFreeHashMap<K, V, H>::contains(const LookupKey& k) const {
+    EpochGuard guard(EpochDomain::global());
+    return finder(k) != nullptr;
+}
+
+// put() function implementation: 
+// A new key is pushed at the head of its bucket. An existing key is replaced by a new node that takes over its link,
+// so a reader sees either the old or the new value, never a half-written one; the old node is retired. 
+template <typename K, typename V, typename H>
+void LockFreeHashMap<K, V, H>::put(const K& k, const V& v) {
+    std::lock_guard<std::mutex> lock(writer);
+    std::size_t h = hash(k);
+    Table* t = table.load(std::memory_order_relaxed);    // Only writers change the table, and we hold the lock. 
+    std::atomic<Node*>* link = &t->heads[h % t->size];   // The link that points to the current node. 
+    Node* x = link->load(std::memory_order_relaxed);
+    while (x != nullptr && (x->hash != h || x->key != k)) {
+        link = &x->next;
+        x = link->load(std::memory_order_relaxed);
+    }
+    if (x != nullptr) {                                  // Replace: the new node continues where the old one did. 
+        Node* y = new Node(k, v, h, x->next.load(std::memory_order_relaxed));
+        link->store(y, std::memory_order_release);       // Publish the fully built node. 
+        retired.retire(x, &deleteNode);                  // Readers may still be on x (and can follow its next). 
+    } else {                                             // Insert at the head of the bucket. 
+        std::atomic<Node*>& head = t->heads[h % t->size];
+        Node* y = new Node(k, v, h, head.load(std::memory_order_relaxed));
+        head.store(y, std::memory_order_release);
+        n.fetch_add(1, std::memory_order_relaxed);
+        if (n.load(std::memory_order_relaxed) > t->size) grow(); // Keep the load factor at or below 1. 
+    }
+    retired.reclaim(); // Free whatever earlier writes retired and readers have left behind. 
+}
+
+// erase() function implementation: 
+// Unlinks the node of key (k) by pointing its predecessor past it; readers already on it can still move on. 
+template <typename K, typename V, typename H>
+bool LockFreeHashMap<K, V, H>::erase(const LookupKey& k) {
+    std::lock_guard<std::mutex> lock(writer);
+    std::size_t h = hash(k);
+    Table* t = table.load(std::memory_order_relaxed);
+    std::atomic<Node*>* link = &t->heads[h % t->size];
+    Node* x = link->load(std::memory_order_relaxed);
+    while (x != nullptr && (x->hash != h || x->key != k)) {
+        link = &x->next;
+        x = link->load(std::memory_order_relaxed);
+    }
+    if (x == nullptr) return false;                      // Nothing to erase. 
+    link->store(x->next.load(std::memory_order_relaxed), std::memory_order_release); // Unlink. 
+    n.fetch_sub(1, std::memory_order_relaxed);
+    retired.retire(x, &deleteNode);                      // Freed once no reader can be on it. 
+    retired.reclaim();
+    return true;
+}
+
+// grow() function implementation: 
+// Copies every node into a table twice as large and publishes it. Readers still walking the old table keep seeing a
+// consistent (old) snapshot; the old table and its nodes are retired as one unit. 
+template <typename K, typename V, typename H>
+void LockFreeHashMap<K, V, H>::grow() {
+    Table* old = table.load(std::memory_order_relaxed);
+    Table* t = new Table(old->size * 2);
+    for (int b = 0; b < old->size; b++) {
+        for (Node* x = old->heads[b].load(std::memory_order_relaxed); x != nullptr; x = x->next.load(std::memory_order_relaxed)) {
+            std::atomic<Node*>& head = t->heads[x->hash % t->size]; // The cached hash avoids rehashing the key. 
+            head.store(new Node(x->key, x->value, x->hash, head.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+        }
+    }
+    table.store(t, std::memory_order_release); // Publish the complete new table. 
+    retired.retire(old, &deleteTable);
+}
+
+// Explicit instantiation of the LockFreeHashMap template for std::string keys and int values. 
+template class LockFreeHashMap<std::string, int, stringHash>;
+template class LockFreeHashMap<std::string, int, fastStringHash>;
@@ -0,0 +1,94 @@
+#pragma once // Ensures this header file is included only once.
+
+#include "epoch.h"   // Includes EpochDomain, EpochGuard and RetireList.
+#include "hashMap.h" // Reuses stringHash, fastStringHash and LookupKeyOf.
+
+#include <atomic>  // Includes std::atomic, used for every pointer a reader follows.
+#include <cstddef> // Includes std::size_t.
+#include <mutex>   // Includes std::mutex, which serializes writers.
+
+// Template class LockFreeHashMap. A chained hash map for read-mostly data whose readers never take a lock.
+// find(), contains() and forEach() only follow atomic pointers inside an epoch (see epoch.h), so they finish in a
+// bounded number of steps no matter what writers do, and a writer never has to wait for them either.
+// Writers (put(), erase()) are serialized by one mutex. They never modify a node a reader may be looking at: a
+// replaced or erased node is unlinked and handed to the epoch reclamation, which frees it once every reader that
+// could have seen it has left. Growing the table builds a new one and publishes it with a single pointer store.
+template <typename K, typename V, typename H>
+class LockFreeHashMap {
+public:
+    typedef typename LookupKeyOf<K, H>::type LookupKey; // Type accepted by find(), contains() and erase(). 
+
+public:
+    // Constructor: Creates a table with (capacity) buckets (default 100). 
+    LockFreeHashMap(int capacity = 100);
+    // Destructor: Frees every node. No thread may be using the map any more. 
+    ~LockFreeHashMap();
+
+    // Returns the number of entries. 
+    int size() const;
+
+    // Returns true if the map is empty. 
+    bool empty() const;
+
+    // Finds the entry with key k; if it exists, copies its value into (v) and returns true. Never blocks. 
+    bool find(const LookupKey& k, V& v) const;
+
+    // Returns true if an entry with key k exists. Never blocks. 
+    bool contains(const LookupKey& k) const;
+
+    // Inserts or replaces a (k,v) pair. A replaced value is published as a new node. 
+    void put(const K& k, const V& v);
+
+    // Removes the entry with key k. Returns true if there was one. 
+    bool erase(const LookupKey& k);
+
+    // Calls f(key, value) for every entry of the table current when the traversal starts. Never blocks. 
+    template <typename F>
+    void forEach(F f) const;
+
+protected:
+    // Structure Node. An immutable (key,value) pair; only the link to the next node ever changes. 
+    struct Node {
+        const K key;              // The key of the entry. 
+        const V value;            // The value of the entry. 
+        const std::size_t hash;   // The hash of the key, so chains can be walked and tables rebuilt without rehashing. 
+        std::atomic<Node*> next;  // The next node in the bucket. 
+        Node(const K& k, const V& v, std::size_t h, Node* nx) : key(k), value(v), hash(h), next(nx) { }
+    };
+
+    // Structure Table. A bucket array; replaced as a whole when the map grows. 
+    struct Table {
+        int size;                  // Number of buckets. 
+        std::atomic<Node*>* heads; // The first node of every bucket. 
+        explicit Table(int buckets);
+        ~Table();                  // Frees the bucket array and every node in it. 
+    };
+
+    // Utility functions for LockFreeHashMap operations. 
+    const Node* finder(const LookupKey& k) const; // Finds the node with key (k); call inside an EpochGuard. 
+    void grow();                                 // Publishes a table twice as large (writer lock held). 
+    static void deleteNode(void* p);             // Deleter for one retired node. 
+    static void deleteTable(void* p);            // Deleter for a retired table with all its nodes. 
+
+private:
+    H hash;                       // The hash function object used to hash keys. 
+    std::atomic<Table*> table;    // The current table, read by lock-free readers. 
+    std::atomic<int> n;           // The number of entries. 
+    std::mutex writer;            // Serializes put() and erase(). 
+    RetireList retired;           // Unlinked nodes and tables waiting for readers to leave (writer lock held). 
+};
+
+// Member template definitions. 
+// forEach() takes an arbitrary function object, so it is defined here where callers can see it. 
+
+// forEach() function implementation: 
+// Walks every bucket of the current table inside one epoch, so no node it visits can be freed meanwhile. 
+template <typename K, typename V, typename H>
+template <typename F>
+void LockFreeHashMap<K, V, H>::forEach(F f) const {
+    EpochGuard guard(EpochDomain::global());
+    Table* t = table.load(std::memory_order_acquire);
+    for (int b = 0; b < t->size; b++)
+        for (Node* x = t->heads[b].load(std::memory_order_acquire); x != nullptr; x = x->next.load(std::memory_order_acquire))
+            f(x->key, x->value);
+}
@@ -0,0 +1,195 @@
+#include "lruCache.h" // Includes the definition of the LruCache class.
+
+// LruCache constructor implementation: 
+// Starts with an empty list, no free nodes and nothing charged. Room is reserved for one node more than the 
+// capacity, since put() adds the new node before it evicts: N never reallocates, so the value pointers returned by 
+// get() and peek() are not invalidated by a later put().
+template <typename K, typename V, typename H>
+LruCache<K, V, H>::LruCache(int capacity, std::size_t maxBytes, Eviction policy)
+    : cap(capacity > 0 ? capacity : 1), budget(maxBytes), clock(policy == Eviction::CLOCK),
+      cursor(-1), freeList(-1), used(0), evicted(0) {
+    N.reserve(std::size_t(cap) + 1);
+}
+
+// unlink() function implementation: 
+// Bypasses node (i), as CDList::remove() does for the front node; if (i) was the back, its predecessor becomes it. 
+template <typename K, typename V, typename H>
+void LruCache<K, V, H>::unlink(int i) {
+    if (N[i].next == i) {                  // The only node: the list becomes empty. 
+        cursor = -1;
+        return;
+    }
+    N[N[i].prev].next = N[i].next;
+    N[N[i].next].prev = N[i].prev;
+    if (cursor == i) cursor = N[i].prev;
+}
+
+// addBack() function implementation: 
+// Inserts node (i) after the cursor, as CDList::add() does, then moves the cursor forward onto it. 
+template <typename K, typename V, typename H>
+void LruCache<K, V, H>::addBack(int i) {
+    if (cursor < 0) {                      // The first node links to itself. 
+        N[i].next = i;
+        N[i].prev = i;
+    } else {
+        N[i].next = N[cursor].next;
+        N[i].prev = cursor;
+        N[N[cursor].next].prev = i;
+        N[cursor].next = i;
+    }
+    cursor = i;
+}
+
+// touch() function implementation: 
+// LRU moves node (i) to the back of the list; CLOCK only sets its reference bit. 
+template <typename K, typename V, typename H>
+void LruCache<K, V, H>::touch(int i) {
+    if (clock) N[i].ref = true;
+    else if (i != cursor) {
+        unlink(i);
+        addBack(i);
+    }
+}
+
+// release() function implementation: 
+// Drops the key and the value of node (i) (so they free their memory now) and pushes the node on the free list. 
+template <typename K, typename V, typename H>
+void LruCache<K, V, H>::release(int i) {
+    N[i].key = K();
+    N[i].value = V();
+    N[i].next = freeList;
+    freeList = i;
+}
+
+// evictOne() function implementation: 
+// The victim is the front node, cursor->next. Moving the cursor forward makes the front node the back one, so the 
+// cursor passes over node (keep), the entry being stored, and with CLOCK over every referenced node, clearing its
+// bit. At most one full turn is needed, since the cache holds another entry besides (keep).
+template <typename K, typename V, typename H>
+void LruCache<K, V, H>::evictOne(int keep) {
+    int f = N[cursor].next;
+    while (f == keep || (clock && N[f].ref)) {
+        N[f].ref = false;
+        cursor = f;                        // CDList::forward(). 
+        f = N[cursor].next;
+    }
+    unlink(f);
+    index.erase(N[f].key);
+    used -= N[f].bytes;
+    release(f);
+    evicted++;
+}
+
+// get() function implementation: 
+// Finds the node of key (k) through the index and records the use. 
+template <typename K, typename V, typename H>
+V* LruCache<K, V, H>::get(const LookupKey& k) {
+    typename HashMap<K, int, H>::Iterator it = index.find(k);
+    if (it == index.end()) return nullptr;
+    int i = (*it).value();
+    touch(i);
+    return &N[i].value;
+}
+
+// peek() function implementation: 
+// Same as get() without touch(). 
+template <typename K, typename V, typename H>
+V* LruCache<K, V, H>::peek(const LookupKey& k) {
+    typename HashMap<K, int, H>::Iterator it = index.find(k);
+    return it == index.end() ? nullptr : &N[(*it).value()].value;
+}
+
+// put() function implementation: 
+// Updates the node of key (k), or takes a free (or new) node for it and adds it at the back of the list, then evicts 
+// until the cache is within both limits again.
+template <typename K, typename V, typename H>
+bool LruCache<K, V, H>::put(const K& k, const V& v, std::size_t bytes) {
+    if (budget != 0 && bytes > budget) {   // It could never fit; the old value must not stay either. 
+        erase(k);
+        return false;
+    }
+    int i;
+    typename HashMap<K, int, H>::Iterator it = index.find(k);
+    if (!(it == index.end())) {            // Existing key: replace the value and the charge. 
+        i = (*it).value();
+        used -= N[i].bytes;
+        N[i].value = v;
+        touch(i);
+    } else {                               // New key: a free node if there is one, otherwise a new one. 
+        if (freeList >= 0) {
+            i = freeList;
+            freeList = N[i].next;
+            N[i].key = k;
+            N[i].value = v;
+        } else {
+            i = int(N.size());
+            N.push_back(Node{ k, v, 0, false, -1, -1 });
+        }
+        N[i].ref = false;
+        index.put(k, i);
+        addBack(i);
+    }
+    N[i].bytes = bytes;
+    used += bytes;
+    while (size() > 1 && (size() > cap || (budget != 0 && used > budget))) evictOne(i);
+    return true;
+}
+
+// erase() function implementation: 
+// Unlinks the node of key (k), removes it from the index and frees it. 
+template <typename K, typename V, typename H>
+bool LruCache<K, V, H>::erase(const LookupKey& k) {
+    typename HashMap<K, int, H>::Iterator it = index.find(k);
+    if (it == index.end()) return false;
+    int i = (*it).value();
+    index.erase(it);
+    unlink(i);
+    used -= N[i].bytes;
+    release(i);
+    return true;
+}
+
+// clear() function implementation: 
+// Replaces the index and the nodes with empty ones. The eviction count is kept. 
+template <typename K, typename V, typename H>
+void LruCache<K, V, H>::clear() {
+    index = HashMap<K, int, H>();
+    N.clear();
+    cursor = -1;
+    freeList = -1;
+    used = 0;
+}
+
+// size() function implementation: 
+// Returns the number of keys in the index. 
+template <typename K, typename V, typename H>
+int LruCache<K, V, H>::size() const { return index.size(); }
+
+// empty() function implementation: 
+// Checks if the cache is empty. 
+template <typename K, typename V, typename H>
+bool LruCache<K, V, H>::empty() const { return size() == 0; }
+
+// capacity() function implementation: 
+// Returns the maximum number of entries. 
+template <typename K, typename V, typename H>
+int LruCache<K, V, H>::capacity() const { return cap; }
+
+// bytes() function implementation: 
+// Returns the bytes charged by the entries in the cache. 
+template <typename K, typename V, typename H>
+std::size_t LruCache<K, V, H>::bytes() const { return used; }
+
+// maxBytes() function implementation: 
+// Returns the byte budget. 
+template <typename K, typename V, typename H>
+std::size_t LruCache<K, V, H>::maxBytes() const { return budget; }
+
+// evictions() function implementation: 
+// Returns the number of evictions so far. 
+template <typename K, typename V, typename H>
+long LruCache<K, V, H>::evictions() const { return evicted; }
+
+// Explicit instantiation of the LruCache template for std::string keys and int values.
+template class LruCache<std::string, int, stringHash>;
+template class LruCache<std::string, int, fastStringHash>;
\ No newline at end of file
@@ -0,0 +1,96 @@
+#pragma once // Ensures this header file is included only once.
+
+#include "hashMap.h" // Includes HashMap, which indexes the cache by key, and the hash functions.
+
+#include <cstddef> // Includes std::size_t.
+#include <vector>  // Includes std::vector, used for the node array.
+
+// Selects how an LruCache chooses the entry to evict.
+enum class Eviction {
+    LRU,  // Evict the least recently used entry; every hit moves its entry to the back of the recency list. 
+    CLOCK // Evict an entry not used since the clock hand last passed it; a hit only sets the entry's reference bit. 
+};
+
+// Template class LruCache. A bounded cache from keys of type (K) to values of type (V), hashed with (H).
+// The entries are kept in a circular doubly linked list like CDList's, with a cursor on the back (most recently
+// inserted or used) entry, so the front (the next one to evict) is cursor->next. The nodes live in an array and are
+// linked by index instead of by pointer, and a HashMap from each key to the index of its node finds it in O(1).
+// The cache holds at most (capacity) entries and, if a byte budget is given, at most that many bytes as charged by
+// put(); whenever a put() exceeds either limit, entries are evicted from the front until both hold again.
+// With Eviction::LRU every hit relinks its node at the back. With Eviction::CLOCK a hit only sets a reference bit,
+// so hits never write to the list: at eviction the cursor moves forward past referenced entries, clearing their
+// bits (this "second chance" approximates LRU), and evicts the first unreferenced one.
+template <typename K, typename V, typename H>
+class LruCache {
+public:
+    typedef typename HashMap<K, int, H>::LookupKey LookupKey; // Type accepted by get(), peek() and erase(). 
+
+    // Constructor: Holds at most (capacity) entries (at least 1) and, if (maxBytes) is not 0, at most (maxBytes) 
+    // bytes as charged by put(). (policy) selects LRU or CLOCK eviction. The nodes for (capacity) entries are 
+    // allocated here, so the node array never moves afterwards. 
+    LruCache(int capacity, std::size_t maxBytes = 0, Eviction policy = Eviction::LRU);
+
+    // Returns the value stored for key k, or nullptr, and records the use of the entry. 
+    // The pointer stays valid until the entry is evicted or erased, or the cache is cleared. 
+    V* get(const LookupKey& k);
+
+    // Returns the value stored for key k, or nullptr, without recording a use. The pointer stays valid as for get(). 
+    V* peek(const LookupKey& k);
+
+    // Stores (v) for key k, charging (bytes) against the byte budget, and records a use of the entry. Evicts other 
+    // entries if a limit is exceeded. Returns false (and removes key k) if (bytes) alone is over the byte budget. 
+    bool put(const K& k, const V& v, std::size_t bytes = 0);
+
+    // Removes the entry with key k. Returns false if there was none. 
+    bool erase(const LookupKey& k);
+
+    // Removes every entry. 
+    void clear();
+
+    // Returns the number of entries in the cache. 
+    int size() const;
+
+    // Returns true if the cache is empty. 
+    bool empty() const;
+
+    // Returns the maximum number of entries. 
+    int capacity() const;
+
+    // Returns the bytes charged by the entries in the cache. 
+    std::size_t bytes() const;
+
+    // Returns the byte budget, or 0 if there is none. 
+    std::size_t maxBytes() const;
+
+    // Returns the number of entries evicted so far (entries removed by erase() are not counted). 
+    long evictions() const;
+
+protected:
+    // A node of the recency list: the entry, its charge, its reference bit and its neighbours. 
+    struct Node {
+        K key;             // The key, needed to remove the node from the index when it is evicted. 
+        V value;           // The cached value. 
+        std::size_t bytes; // The charge of the entry against the byte budget. 
+        bool ref;          // CLOCK: set by every use, cleared when the cursor passes the node. 
+        int next;          // Index of the next node of the list (towards the front), or of the next free node. 
+        int prev;          // Index of the previous node of the list. 
+    };
+
+    // Utility functions for LruCache operations. 
+    void unlink(int i);         // Internal utility function removing node (i) from the list. 
+    void addBack(int i);        // Internal utility function inserting node (i) after the cursor and moving the cursor to it. 
+    void touch(int i);          // Internal utility function recording a use of node (i). 
+    void evictOne(int keep);    // Internal utility function evicting one entry other than node (keep). 
+    void release(int i);        // Internal utility function returning node (i) to the free list. 
+
+private:
+    HashMap<K, int, H> index;  // Maps every key to the index of its node. 
+    std::vector<Node> N;       // The nodes; freed nodes are reused, and room for cap + 1 is reserved up front. 
+    int cap;                   // The maximum number of entries. 
+    std::size_t budget;        // The byte budget, or 0. 
+    bool clock;                // True for CLOCK eviction, false for LRU. 
+    int cursor;                // The back of the list (most recent entry), or -1 if the list is empty. 
+    int freeList;              // The first free node, or -1. 
+    std::size_t used;          // The bytes charged by the entries in the cache. 
+    long evicted;              // The number of evictions so far. 
+};
\ No newline at end of file
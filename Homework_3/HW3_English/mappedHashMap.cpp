@@ -0,0 +1,198 @@
+#include "mappedHashMap.h" // Includes the definition of the MappedHashMap class.
+
+#if defined(_WIN32)
+#include <windows.h>  // Includes CreateFile, CreateFileMapping and MapViewOfFile.
+#else
+#include <fcntl.h>    // Includes open().
+#include <sys/mman.h> // Includes mmap() and munmap().
+#include <sys/stat.h> // Includes fstat().
+#include <unistd.h>   // Includes close().
+#endif
+
+// MappedFile::open() function implementation: 
+// Maps the whole file read-only. An empty file cannot be mapped and is reported as a failure. 
+bool MappedFile::open(const std::string& path) {
+    close();
+#if defined(_WIN32)
+    HANDLE f = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (f == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER sz;
+    if (!GetFileSizeEx(f, &sz) || sz.QuadPart == 0) { CloseHandle(f); return false; }
+    HANDLE m = CreateFileMappingA(f, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (m == NULL) { CloseHandle(f); return false; }
+    void* p = MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0);
+    if (p == NULL) { CloseHandle(m); CloseHandle(f); return false; }
+    handle = f;
+    mapping = m;
+    base = static_cast<const char*>(p);
+    length = std::size_t(sz.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) { ::close(fd); return false; }
+    void* p = mmap(nullptr, std::size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // The mapping stays valid after the descriptor is closed. 
+    if (p == MAP_FAILED) return false;
+    base = static_cast<const char*>(p);
+    length = std::size_t(st.st_size);
+#endif
+    return true;
+}
+
+// MappedFile::close() function implementation: 
+// Releases the mapping and, on Windows, its handles. 
+void MappedFile::close() {
+    if (base == nullptr) return;
+#if defined(_WIN32)
+    UnmapViewOfFile(base);
+    CloseHandle(static_cast<HANDLE>(mapping));
+    CloseHandle(static_cast<HANDLE>(handle));
+    handle = mapping = nullptr;
+#else
+    munmap(const_cast<char*>(base), length);
+#endif
+    base = nullptr;
+    length = 0;
+}
+
+// MappedHashMap constructor implementation: 
+// Starts closed: nothing mapped and nothing promoted. 
+template <typename K, typename V, typename H>
+MappedHashMap<K, V, H>::MappedHashMap() : header(nullptr) { }
+
+// open() function implementation: 
+// Maps the file and validates that every region named in the header lies inside it. 
+template <typename K, typename V, typename H>
+bool MappedHashMap<K, V, H>::open(const std::string& path) {
+    promoted.reset();
+    header = nullptr;
+    if (!file.open(path)) return false;
+    const SnapshotHeader* h = reinterpret_cast<const SnapshotHeader*>(file.data());
+    bool valid = file.size() >= sizeof(SnapshotHeader)
+        && std::memcmp(h->magic, "HMSNAP1", 8) == 0
+        && h->version == 1
+        && h->recordSize == sizeof(Record)              // Written with the same value type. 
+        && h->fileSize == file.size()
+        && h->buckets > 0
+        && h->startOff + (h->buckets + 1) * sizeof(std::uint64_t) <= h->recordOff
+        && h->recordOff % alignof(Record) == 0
+        && h->recordOff + h->count * sizeof(Record) <= h->keyOff
+        && h->keyOff <= h->fileSize;
+    if (!valid) {
+        file.close();
+        return false;
+    }
+    header = h;
+    return true;
+}
+
+// isMapped() function implementation: 
+// Lookups use the file until a mutation promotes it. 
+template <typename K, typename V, typename H>
+bool MappedHashMap<K, V, H>::isMapped() const { return header != nullptr; }
+
+// isPromoted() function implementation: 
+// Returns true once the entries live in a HashMap. 
+template <typename K, typename V, typename H>
+bool MappedHashMap<K, V, H>::isPromoted() const { return promoted != nullptr; }
+
+// size() function implementation: 
+// Returns the entry count of the mapping, the promoted map, or 0. 
+template <typename K, typename V, typename H>
+int MappedHashMap<K, V, H>::size() const {
+    if (promoted) return promoted->size();
+    return header ? int(header->count) : 0;
+}
+
+// empty() function implementation: 
+// Checks if there are no entries. 
+template <typename K, typename V, typename H>
+bool MappedHashMap<K, V, H>::empty() const { return size() == 0; }
+
+// finder() function implementation: 
+// Scans the records of the key's bucket, comparing the stored hash before the key bytes. 
+template <typename K, typename V, typename H>
+const typename MappedHashMap<K, V, H>::Record* MappedHashMap<K, V, H>::finder(const LookupKey& k) const {
+    std::uint64_t h = hash(k);
+    const std::uint64_t* start = reinterpret_cast<const std::uint64_t*>(file.data() + header->startOff);
+    const Record* records = reinterpret_cast<const Record*>(file.data() + header->recordOff);
+    std::uint64_t b = h % header->buckets;
+    for (std::uint64_t r = start[b]; r < start[b + 1] && r < header->count; r++) {
+        const Record& rec = records[r];
+        if (rec.hash == h && rec.keyOffset <= header->fileSize && rec.keyLength <= header->fileSize - rec.keyOffset
+            && SnapshotKey<K>::equals(file.data() + rec.keyOffset, rec.keyLength, k))
+            return &rec;
+    }
+    return nullptr;
+}
+
+// find() function implementation: 
+// Reads from the promoted map if there is one, otherwise straight from the mapping. 
+template <typename K, typename V, typename H>
+bool MappedHashMap<K, V, H>::find(const LookupKey& k, V& v) const {
+    if (promoted) {
+        typename Map::Iterator p = promoted->find(k);
+        if (p == promoted->end()) return false;
+        v = (*p).value();
+        return true;
+    }
+    if (header == nullptr) return false;
+    const Record* rec = finder(k);
+    if (rec == nullptr) return false;
+    v = rec->value;
+    return true;
+}
+
+// contains() function implementation: 
+// Checks for key (k) without copying its value out. 
+template <typename K, typename V, typename H>
+bool MappedHashMap<K, V, H>::contains(const LookupKey& k) const {
+    if (promoted) return !(promoted->find(k) == promoted->end());
+    return header != nullptr && finder(k) != nullptr;
+}
+
+// promote() function implementation: 
+// Checks that every record's key lies inside the file, then copies every record into a new HashMap sized for them and 
+// drops the mapping. A record pointing outside the file means the snapshot is corrupt: nothing is promoted. 
+template <typename K, typename V, typename H>
+bool MappedHashMap<K, V, H>::promote() {
+    if (promoted) return true;
+    if (header == nullptr) {
+        promoted.reset(new Map());
+        return true;
+    }
+    const Record* records = reinterpret_cast<const Record*>(file.data() + header->recordOff);
+    for (std::uint64_t r = 0; r < header->count; r++) // Written so that a huge offset or length cannot overflow. 
+        if (records[r].keyOffset > header->fileSize || records[r].keyLength > header->fileSize - records[r].keyOffset)
+            return false;
+    promoted.reset(new Map());
+    promoted->reserve(int(header->count));
+    for (std::uint64_t r = 0; r < header->count; r++)
+        promoted->put(SnapshotKey<K>::decode(file.data() + records[r].keyOffset, records[r].keyLength), records[r].value);
+    header = nullptr;
+    file.close();
+    return true;
+}
+
+// put() function implementation: 
+// Mutations always go to the promoted map. 
+template <typename K, typename V, typename H>
+bool MappedHashMap<K, V, H>::put(const K& k, const V& v) {
+    if (!promote()) return false;
+    promoted->put(k, v);
+    return true;
+}
+
+// erase() function implementation: 
+// Erasing a missing key does not promote the snapshot. 
+template <typename K, typename V, typename H>
+bool MappedHashMap<K, V, H>::erase(const LookupKey& k) {
+    if (!contains(k) || !promote()) return false;
+    promoted->erase(k);
+    return true;
+}
+
+// Explicit instantiation of the MappedHashMap template for std::string keys and int values. 
+template class MappedHashMap<std::string, int, stringHash>;
+template class MappedHashMap<std::string, int, fastStringHash>;
@@ -0,0 +1,214 @@
+#pragma once // Ensures this header file is included only once.
+
+#include "hashMap.h" // The snapshot is written from, and promoted back into, an ordinary HashMap.
+
+#include <cstddef>     // Includes std::size_t.
+#include <cstdint>     // Includes the fixed-width integer types of the file format.
+#include <cstring>     // Includes std::memcpy and std::memcmp.
+#include <fstream>     // Includes std::ofstream, used by saveSnapshot().
+#include <memory>      // Includes std::unique_ptr, which owns the promoted map.
+#include <string>      // Includes std::string, the key type with variable-length encoding.
+#include <string_view> // Includes std::string_view.
+#include <type_traits> // Includes std::is_trivially_copyable.
+#include <vector>      // Includes std::vector, used to lay out the file before writing it.
+
+// Snapshot file layout (all offsets are from the start of the file, so the image is position independent):
+//   SnapshotHeader
+//   std::uint64_t start[buckets + 1]   records of bucket b are start[b] .. start[b+1]-1
+//   SnapshotRecord<V> records[count]   grouped by bucket
+//   char keyBytes[]                    the encoded keys, referenced by (keyOffset, keyLength)
+// Integers are stored in host byte order, so a snapshot is only read back on the kind of machine that wrote it.
+
+// Structure SnapshotHeader. The fixed-size start of a snapshot file. 
+struct SnapshotHeader {
+    char magic[8];             // "HMSNAP1" followed by a zero byte. 
+    std::uint32_t version;     // Format version (1). 
+    std::uint32_t recordSize;  // sizeof(SnapshotRecord<V>) of the writer, to catch a mismatched value type. 
+    std::uint64_t count;       // Number of entries. 
+    std::uint64_t buckets;     // Number of buckets. 
+    std::uint64_t startOff;    // Offset of the bucket start array. 
+    std::uint64_t recordOff;   // Offset of the record array. 
+    std::uint64_t keyOff;      // Offset of the key bytes. 
+    std::uint64_t fileSize;    // Total size of the file. 
+};
+
+// Template structure SnapshotRecord. One entry: the hash and location of its key, and the value itself. 
+template <typename V>
+struct SnapshotRecord {
+    std::uint64_t hash;      // Full hash of the key, compared before the key bytes. 
+    std::uint64_t keyOffset; // Offset of the encoded key. 
+    std::uint64_t keyLength; // Length of the encoded key in bytes. 
+    V value;                 // The value, stored as is (V must be trivially copyable). 
+};
+
+// Template structure SnapshotKey. Encodes keys as bytes and compares stored bytes with a lookup key.
+// The general version handles trivially copyable keys; std::string is specialized below. 
+template <typename K>
+struct SnapshotKey {
+    static_assert(std::is_trivially_copyable<K>::value, "snapshot keys must be std::string or trivially copyable");
+    static const char* data(const K& k) { return reinterpret_cast<const char*>(&k); }
+    static std::size_t size(const K&) { return sizeof(K); }
+    static K decode(const char* p, std::size_t) { K k; std::memcpy(&k, p, sizeof(K)); return k; }
+    static bool equals(const char* p, std::size_t, const K& k) { return decode(p, sizeof(K)) == k; }
+};
+
+// Specialization of SnapshotKey for std::string keys, stored as their characters. 
+template <>
+struct SnapshotKey<std::string> {
+    static const char* data(const std::string& k) { return k.data(); }
+    static std::size_t size(const std::string& k) { return k.size(); }
+    static std::string decode(const char* p, std::size_t n) { return std::string(p, n); }
+    static bool equals(const char* p, std::size_t n, std::string_view k) { return std::string_view(p, n) == k; }
+};
+
+// Class MappedFile. A read-only memory mapping of a whole file (mmap on POSIX, a file mapping on Windows). 
+class MappedFile {
+public:
+    MappedFile() : base(nullptr), length(0), handle(nullptr), mapping(nullptr) { }
+    ~MappedFile() { close(); }
+
+    // Maps the file at (path). Returns false (leaving the object closed) if it cannot be opened or mapped. 
+    bool open(const std::string& path);
+    // Unmaps the file, if one is mapped. 
+    void close();
+
+    // Returns the first byte of the mapping (nullptr if closed). 
+    const char* data() const { return base; }
+    // Returns the size of the mapping in bytes. 
+    std::size_t size() const { return length; }
+
+private:
+    const char* base;   // Start of the mapping. 
+    std::size_t length; // Length of the mapping. 
+    void* handle;       // Windows file handle (unused on POSIX). 
+    void* mapping;      // Windows mapping handle (unused on POSIX). 
+
+    MappedFile(const MappedFile&);            // A mapping has a single owner. 
+    MappedFile& operator=(const MappedFile&);
+};
+
+// Template class MappedHashMap. Serves lookups straight out of a memory-mapped snapshot written by saveSnapshot(),
+// so opening a table of any size costs one mmap() call instead of re-inserting every entry; pages are only read
+// from disk when a lookup touches them.
+// The mapping is read-only. The first put() or erase() promotes the snapshot into an ordinary HashMap (copying every
+// entry once) and all later operations use that map; the file itself is never modified. 
+template <typename K, typename V, typename H>
+class MappedHashMap {
+public:
+    typedef HashMap<K, V, H> Map;                       // The map a snapshot is promoted into. 
+    typedef typename LookupKeyOf<K, H>::type LookupKey; // Type accepted by find(), contains() and erase(). 
+
+public:
+    // Constructor: Creates a closed map (empty, not promoted). 
+    MappedHashMap();
+
+    // Maps the snapshot at (path) and checks its header. Returns false if the file is missing, truncated, or was
+    // written for a different value type; the map is then left empty. 
+    bool open(const std::string& path);
+
+    // Returns true while lookups are served from the mapped file. 
+    bool isMapped() const;
+
+    // Returns true once a mutation has promoted the snapshot into a HashMap. 
+    bool isPromoted() const;
+
+    // Returns the number of entries. 
+    int size() const;
+
+    // Returns true if the map is empty. 
+    bool empty() const;
+
+    // Finds the entry with key k; if it exists, copies its value into (v) and returns true. 
+    bool find(const LookupKey& k, V& v) const;
+
+    // Returns true if an entry with key k exists. 
+    bool contains(const LookupKey& k) const;
+
+    // Inserts or replaces a (k,v) pair, promoting the snapshot first if needed. Returns false, changing nothing, if the
+    // snapshot is corrupt and cannot be promoted. 
+    bool put(const K& k, const V& v);
+
+    // Removes the entry with key k, promoting the snapshot first if needed. Returns true if there was one and it was
+    // removed; false if there was none or the snapshot is corrupt and cannot be promoted. 
+    bool erase(const LookupKey& k);
+
+    // Promotes the snapshot (if not done yet) into a HashMap. Returns false, leaving the snapshot mapped, if one of its 
+    // records points outside the file. 
+    bool promote();
+
+protected:
+    typedef SnapshotRecord<V> Record; // One record of the file. 
+
+    // Utility function returning the record of key (k) in the mapping, or nullptr. 
+    const Record* finder(const LookupKey& k) const;
+
+private:
+    H hash;                        // The hash function object; must be the one the snapshot was written with. 
+    MappedFile file;               // The mapping. 
+    const SnapshotHeader* header;  // The header of the mapped snapshot (nullptr if not mapped). 
+    std::unique_ptr<Map> promoted; // The promoted map, once a mutation happened. 
+
+    MappedHashMap(const MappedHashMap&);            // The mapping has a single owner. 
+    MappedHashMap& operator=(const MappedHashMap&);
+};
+
+// saveSnapshot() function implementation: 
+// Writes every entry of (map) to (path) in the snapshot format, with one bucket per entry. Returns false if the file
+// cannot be written. This is a function template over the map's allocator and statistics policy, so it is defined here in the header. 
+template <typename K, typename V, typename H, typename A, typename P>
+bool saveSnapshot(HashMap<K, V, H, A, P>& map, const std::string& path) {
+    static_assert(std::is_trivially_copyable<V>::value, "snapshot values must be trivially copyable");
+    typedef SnapshotRecord<V> Record;
+    typedef typename HashMap<K, V, H, A, P>::Iterator Iterator;
+    H hash;                                                    // Same hash function the reader will use. 
+    std::uint64_t count = map.size();
+    std::uint64_t buckets = count > 0 ? count : 1;             // Load factor 1. 
+    std::vector<std::uint64_t> start(buckets + 1, 0);          // Becomes the bucket start array. 
+    std::vector<std::uint64_t> hashes;                         // Hash of every entry, in iteration order. 
+    std::uint64_t keyBytes = 0;                                // Total size of the encoded keys. 
+    for (Iterator it = map.begin(); !(it == map.end()); ++it) { // First pass: count the entries of every bucket. 
+        std::uint64_t h = hash((*it).key());
+        hashes.push_back(h);
+        start[h % buckets + 1]++;
+        keyBytes += SnapshotKey<K>::size((*it).key());
+    }
+    for (std::uint64_t b = 0; b < buckets; b++) start[b + 1] += start[b]; // Prefix sums: first record of each bucket. 
+
+    SnapshotHeader head;
+    std::memset(&head, 0, sizeof(head));
+    std::memcpy(head.magic, "HMSNAP1", 8);
+    head.version = 1;
+    head.recordSize = sizeof(Record);
+    head.count = count;
+    head.buckets = buckets;
+    head.startOff = (sizeof(SnapshotHeader) + 7) / 8 * 8;
+    head.recordOff = (head.startOff + (buckets + 1) * sizeof(std::uint64_t) + alignof(Record) - 1) / alignof(Record) * alignof(Record);
+    head.keyOff = head.recordOff + count * sizeof(Record);
+    head.fileSize = head.keyOff + keyBytes;
+
+    std::vector<Record> records(count);                        // Second pass: place every record in its bucket. 
+    std::vector<char> keys(keyBytes);
+    std::vector<std::uint64_t> next(start.begin(), start.end() - 1); // Next free record of every bucket. 
+    std::uint64_t keyPos = 0, e = 0;
+    for (Iterator it = map.begin(); !(it == map.end()); ++it, ++e) {
+        Record& r = records[next[hashes[e] % buckets]++];
+        std::memset(&r, 0, sizeof(Record));                    // Keep padding bytes deterministic. 
+        r.hash = hashes[e];
+        r.keyOffset = head.keyOff + keyPos;
+        r.keyLength = SnapshotKey<K>::size((*it).key());
+        r.value = (*it).value();
+        if (r.keyLength > 0) std::memcpy(&keys[keyPos], SnapshotKey<K>::data((*it).key()), r.keyLength);
+        keyPos += r.keyLength;
+    }
+
+    std::ofstream out(path.c_str(), std::ios::binary | std::ios::trunc);
+    if (!out) return false;
+    std::vector<char> pad(alignof(Record) + 8, 0);             // Zero bytes for the alignment gaps. 
+    out.write(reinterpret_cast<const char*>(&head), sizeof(head));
+    out.write(pad.data(), head.startOff - sizeof(head));
+    out.write(reinterpret_cast<const char*>(start.data()), start.size() * sizeof(std::uint64_t));
+    out.write(pad.data(), head.recordOff - head.startOff - start.size() * sizeof(std::uint64_t));
+    if (count > 0) out.write(reinterpret_cast<const char*>(records.data()), count * sizeof(Record));
+    if (keyBytes > 0) out.write(keys.data(), keyBytes);
+    return bool(out.flush());
+}
@@ -0,0 +1,88 @@
+#include "poolAllocator.h" // Includes the definitions of the NodePool and SizeClassPool classes.
+
+// NodePool constructor implementation: 
+// Starts with no slabs; the block size is decided by the first allocation. 
+NodePool::NodePool(std::size_t firstSlabBlocks)
+    : blockSize(0), slabBlocks(firstSlabBlocks > 0 ? firstSlabBlocks : 1), freeList(nullptr) { }
+
+// NodePool destructor implementation: 
+// Returns every slab to the global allocator. 
+NodePool::~NodePool() {
+    for (std::size_t i = 0; i < slabs.size(); i++)
+        ::operator delete(slabs[i]);
+}
+
+// fits() function implementation: 
+// Blocks are aligned like ::operator new, so anything up to the block size with ordinary alignment fits. 
+bool NodePool::fits(std::size_t size, std::size_t align) const {
+    return blockSize != 0 && size <= blockSize && align <= alignof(std::max_align_t);
+}
+
+// allocate() function implementation: 
+// Pops a block off the free list, growing the pool first if the list is empty. 
+void* NodePool::allocate(std::size_t size, std::size_t align) {
+    if (blockSize == 0 && align <= alignof(std::max_align_t)) { // The first allocation fixes the block size: 
+        blockSize = size < sizeof(FreeNode) ? sizeof(FreeNode) : size; // large enough for a free-list link, 
+        blockSize = (blockSize + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t); // and keeping every block aligned. 
+    }
+    if (!fits(size, align)) return nullptr; // Let the caller fall back to the global allocator. 
+    if (freeList == nullptr) grow();        // Refill the free list with a new slab. 
+    FreeNode* node = freeList;              // Take the first free block. 
+    freeList = node->next;
+    return node;
+}
+
+// deallocate() function implementation: 
+// Pushes block (p) onto the free list; the memory stays in the pool for the next allocation. 
+void NodePool::deallocate(void* p) {
+    FreeNode* node = static_cast<FreeNode*>(p);
+    node->next = freeList;
+    freeList = node;
+}
+
+// grow() function implementation: 
+// Allocates a slab of (slabBlocks) blocks and links them, in address order, onto the free list. 
+void NodePool::grow() {
+    char* slab = static_cast<char*>(::operator new(blockSize * slabBlocks)); // One allocation for many blocks. 
+    slabs.push_back(slab);
+    for (std::size_t i = slabBlocks; i-- > 0; ) {  // Push in reverse so blocks are handed out in address order. 
+        FreeNode* node = reinterpret_cast<FreeNode*>(slab + i * blockSize);
+        node->next = freeList;
+        freeList = node;
+    }
+    if (slabBlocks < 65536 && 2 * slabBlocks * blockSize <= SLAB_BYTES) slabBlocks *= 2; // Grow slabs geometrically so large maps need few slabs. 
+}
+
+// SizeClassPool constructor implementation: 
+// Creates the pool of every class. A slab holds about 4 KiB worth of small blocks at first, and at least one block. 
+SizeClassPool::SizeClassPool() {
+    for (std::size_t b = MIN_BLOCK; b <= MAX_BLOCK; b *= 2)
+        pools.push_back(std::unique_ptr<NodePool>(new NodePool(b < 4096 ? 4096 / b : 1)));
+}
+
+// classOf() function implementation: 
+// Doubles the block size from MIN_BLOCK until it holds (size) bytes. 
+int SizeClassPool::classOf(std::size_t size) {
+    int c = 0;
+    for (std::size_t b = MIN_BLOCK; b < size; b *= 2) c++;
+    return c;
+}
+
+// fits() function implementation: 
+// The largest class bounds the size; the blocks are aligned like ::operator new. 
+bool SizeClassPool::fits(std::size_t size, std::size_t align) {
+    return size <= MAX_BLOCK && align <= alignof(std::max_align_t);
+}
+
+// allocate() function implementation: 
+// Takes a block from the pool of the smallest class holding (size) bytes. The first request of a class asks for 
+// the full class size, which fixes the block size of its NodePool.
+void* SizeClassPool::allocate(std::size_t size, std::size_t align) {
+    if (!fits(size, align)) return nullptr;
+    int c = classOf(size);
+    return pools[c]->allocate(MIN_BLOCK << c, align);
+}
+
+// deallocate() function implementation: 
+// Returns block (p) to the pool of the class it was taken from. 
+void SizeClassPool::deallocate(void* p, std::size_t size) { pools[classOf(size)]->deallocate(p); }
@@ -0,0 +1,113 @@
+#pragma once // Ensures this header file is included only once.
+
+#include <cstddef> // Includes std::size_t.
+#include <memory>  // Includes std::shared_ptr and std::unique_ptr; every copy of a PoolAllocator shares one pool.
+#include <new>     // Includes ::operator new and ::operator delete.
+#include <type_traits> // Includes std::true_type.
+#include <vector>  // Includes std::vector, which records the slabs of a pool.
+
+// Class NodePool. Hands out fixed-size blocks carved from large slabs and recycles freed blocks through a free list,
+// so allocating and freeing a node costs a few instructions and never reaches the global allocator once warmed up.
+// The block size is fixed by the first allocation. A pool is not thread-safe: a container and its copies share one
+// pool, so they must be used from one thread (or under one lock).
+class NodePool {
+public:
+    // Constructor: Creates an empty pool whose first slab holds (firstSlabBlocks) blocks. 
+    explicit NodePool(std::size_t firstSlabBlocks = 64);
+    // Destructor: Releases every slab. All blocks must have been returned (or be no longer used) by then. 
+    ~NodePool();
+
+    // Returns a block of (size) bytes aligned to (align), or nullptr if such objects do not fit the pool's blocks. 
+    void* allocate(std::size_t size, std::size_t align);
+    // Returns block (p), obtained from allocate(), to the free list. 
+    void deallocate(void* p);
+    // Returns true if objects of (size) bytes aligned to (align) are served by this pool. 
+    bool fits(std::size_t size, std::size_t align) const;
+
+private:
+    struct FreeNode { FreeNode* next; }; // A free block, linked through its own storage. 
+
+    void grow(); // Allocates a new slab and threads its blocks onto the free list. 
+
+    std::size_t blockSize;       // Size of every block in bytes (0 until the first allocation). 
+    std::size_t slabBlocks;      // Number of blocks in the next slab; doubles with every slab up to a limit. 
+    FreeNode* freeList;          // Head of the list of free blocks. 
+    std::vector<void*> slabs;    // Every slab obtained from ::operator new. 
+
+    NodePool(const NodePool&);            // Pools are shared through PoolAllocator, never copied. 
+    NodePool& operator=(const NodePool&);
+
+    static const std::size_t SLAB_BYTES = std::size_t(4) << 20; // Slabs stop doubling at this size (unless one block is larger). 
+};
+
+// Class SizeClassPool. One NodePool for every power-of-two block size from MIN_BLOCK to MAX_BLOCK bytes, so blocks
+// of any size up to MAX_BLOCK are recycled: a request is served by the smallest class that holds it. Growing arrays
+// (the entry and bucket arrays of a HashMap, for example) release their old storage to the pool, and the next array
+// of that size, in this container or another one sharing the pool, reuses it instead of calling ::operator new.
+// Memory returned to the pool stays there until the pool is destroyed.
+class SizeClassPool {
+public:
+    static const std::size_t MIN_BLOCK = 16;                   // Size of the smallest class in bytes. 
+    static const std::size_t MAX_BLOCK = std::size_t(1) << 20; // Size of the largest class in bytes. 
+
+    // Constructor: Creates an empty pool for every class. 
+    SizeClassPool();
+
+    // Returns a block of at least (size) bytes aligned to (align), or nullptr if no class serves such a request. 
+    void* allocate(std::size_t size, std::size_t align);
+    // Returns block (p), obtained from allocate() with the same (size) and (align), to its class. 
+    void deallocate(void* p, std::size_t size);
+    // Returns true if requests for (size) bytes aligned to (align) are served by a class. 
+    static bool fits(std::size_t size, std::size_t align);
+
+private:
+    static int classOf(std::size_t size); // Index of the smallest class holding (size) bytes. 
+
+    std::vector<std::unique_ptr<NodePool> > pools; // The pool of every class, smallest first. 
+};
+
+// Template class PoolAllocator. A standard allocator that serves allocations of up to SizeClassPool::MAX_BLOCK bytes
+// (single nodes as well as arrays, such as the entry and bucket arrays of a HashMap) from a SizeClassPool and
+// forwards larger ones to ::operator new.
+// Copies and rebound copies share the same pool, so all containers built from one allocator draw from one pool.
+template <typename T>
+class PoolAllocator {
+public:
+    typedef T value_type; // The type of object allocated. 
+    typedef std::true_type propagate_on_container_copy_assignment; // The pool follows the elements around. 
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
+    // Constructor: Creates an allocator with a new, empty pool. 
+    PoolAllocator() : pool(std::make_shared<SizeClassPool>()) { }
+    // Converting constructor: Shares the pool of an allocator for another type (used when containers rebind). 
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) : pool(other.pool) { }
+
+    // Allocates storage for (count) objects of type T. 
+    T* allocate(std::size_t count) {
+        if (count <= SizeClassPool::MAX_BLOCK / sizeof(T)) {  // Anything up to the largest class comes from the pool. 
+            void* p = pool->allocate(count * sizeof(T), alignof(T));
+            if (p != nullptr) return static_cast<T*>(p);
+        }
+        return static_cast<T*>(::operator new(count * sizeof(T))); // Larger and over-aligned requests use the global allocator. 
+    }
+
+    // Releases storage for (count) objects of type T obtained from allocate(). 
+    void deallocate(T* p, std::size_t count) {
+        if (count <= SizeClassPool::MAX_BLOCK / sizeof(T) && SizeClassPool::fits(count * sizeof(T), alignof(T)))
+            pool->deallocate(p, count * sizeof(T)); // Same rule as allocate(). 
+        else ::operator delete(p);
+    }
+
+    // Two allocators are equal if memory from one can be released through the other, i.e. they share a pool. 
+    template <typename U>
+    bool operator==(const PoolAllocator<U>& other) const { return pool == other.pool; }
+    template <typename U>
+    bool operator!=(const PoolAllocator<U>& other) const { return pool != other.pool; }
+
+private:
+    std::shared_ptr<SizeClassPool> pool; // The pool shared by every copy of this allocator. 
+
+    template <typename U> friend class PoolAllocator; // Grants rebound allocators access to the pool. 
+};
@@ -0,0 +1,255 @@
+#include "stringHashMap.h" // Includes the definitions of StringKey, KeyArena and StringHashMap.
+
+// KeyArena constructor implementation: 
+// Starts without chunks; the first long key allocates one. 
+KeyArena::KeyArena() : cur(nullptr), left(0), used(0), wasted(0) { }
+
+// store() function implementation: 
+// Copies the key into the current chunk, starting a new chunk if it does not fit. A key longer than a quarter of a 
+// chunk gets a chunk of its own, so the unused tail of the current chunk is not thrown away for it.
+const char* KeyArena::store(const char* p, std::size_t length) {
+    char* dst;
+    if (length > CHUNK / 4) {                        // Large key: a dedicated chunk of exactly its size. 
+        chunks.emplace_back(new char[length]);
+        dst = chunks.back().get();
+    } else {
+        if (length > left) {                         // The current chunk is full: start a new one. 
+            chunks.emplace_back(new char[CHUNK]);
+            cur = chunks.back().get();
+            left = CHUNK;
+        }
+        dst = cur;
+        cur += length;
+        left -= length;
+    }
+    std::memcpy(dst, p, length);
+    used += length;
+    return dst;
+}
+
+// swap() function implementation: 
+// Exchanges every member; the chunks (and so the stored keys) do not move. 
+void KeyArena::swap(KeyArena& other) {
+    chunks.swap(other.chunks);
+    std::swap(cur, other.cur);
+    std::swap(left, other.left);
+    std::swap(used, other.used);
+    std::swap(wasted, other.wasted);
+}
+
+// StringHashMap constructor implementation: 
+// Creates (capacity) empty buckets and starts with a maximum load factor of 1. 
+template <typename V, typename H>
+StringHashMap<V, H>::StringHashMap(int capacity) : maxLoad(1.0f), B(capacity > 0 ? capacity : 1, -1) { }
+
+// Copy constructor implementation: 
+// Copies the entries and the buckets, then gives every long key a copy in this map's arena (the copied entries 
+// still point into the arena of (other)).
+template <typename V, typename H>
+StringHashMap<V, H>::StringHashMap(const StringHashMap& other)
+    : maxLoad(other.maxLoad), hash(other.hash), S(other.S), B(other.B) {
+    for (std::size_t i = 0; i < S.size(); i++) {
+        StringKey& k = S[i].k;
+        if (k.isLong()) {
+            std::string_view v = k.view();
+            k.setLong(arena.store(v.data(), v.size()), v.size());
+        }
+    }
+}
+
+// Copy assignment implementation: 
+// Builds a copy of (other) and swaps it in, so this map is unchanged if the copy fails. 
+template <typename V, typename H>
+StringHashMap<V, H>& StringHashMap<V, H>::operator=(const StringHashMap& other) {
+    if (this == &other) return *this;
+    StringHashMap copy(other);
+    std::swap(maxLoad, copy.maxLoad);
+    std::swap(hash, copy.hash);
+    S.swap(copy.S);
+    B.swap(copy.B);
+    arena.swap(copy.arena);
+    return *this;
+}
+
+// fold() function implementation: 
+// Keeps 32 bits of the hash value, mixing in the upper half so that no bits are simply dropped. 
+template <typename V, typename H>
+std::uint32_t StringHashMap<V, H>::fold(std::size_t h) {
+    return std::uint32_t(std::uint64_t(h) ^ (std::uint64_t(h) >> 32));
+}
+
+// size() function implementation: 
+// Returns the current number of entries, i.e. the length of the entry array S. 
+template <typename V, typename H>
+int StringHashMap<V, H>::size() const { return int(S.size()); }
+
+// empty() function implementation: 
+// Checks if the map is empty. 
+template <typename V, typename H>
+bool StringHashMap<V, H>::empty() const { return size() == 0; }
+
+// bucketCount() function implementation: 
+// Returns the number of buckets in the bucket array B. 
+template <typename V, typename H>
+int StringHashMap<V, H>::bucketCount() const { return int(B.size()); }
+
+// loadFactor() function implementation: 
+// Returns the average number of entries per bucket. 
+template <typename V, typename H>
+float StringHashMap<V, H>::loadFactor() const { return float(size()) / B.size(); }
+
+// maxLoadFactor() function implementation: 
+// Returns the load factor above which the bucket array is grown. 
+template <typename V, typename H>
+float StringHashMap<V, H>::maxLoadFactor() const { return maxLoad; }
+
+// setMaxLoadFactor() function implementation: 
+// Stores the new maximum load factor and rehashes immediately if the map is already above it. 
+template <typename V, typename H>
+void StringHashMap<V, H>::setMaxLoadFactor(float f) {
+    if (f <= 0) return;            // A non-positive load factor is meaningless; keep the current one. 
+    maxLoad = f;
+    if (loadFactor() > maxLoad) reserve(size());
+}
+
+// reserve() function implementation: 
+// Reserves room for (count) entries and grows the bucket array so that they fit under the maximum load factor. 
+template <typename V, typename H>
+void StringHashMap<V, H>::reserve(int count) {
+    if (count > 0) S.reserve(count);
+    int need = int(count / maxLoad) + 1;
+    if (need > bucketCount()) rehash(need);
+}
+
+// rehash() function implementation: 
+// Rebuilds the bucket chains from the cached hashes; no key is hashed again and no entry moves. 
+template <typename V, typename H>
+void StringHashMap<V, H>::rehash(int buckets) {
+    int minimum = int(size() / maxLoad) + 1; // Never rehash into fewer buckets than the load factor allows. 
+    if (buckets < minimum) buckets = minimum;
+    B.assign(buckets, -1);
+    for (int i = 0; i < size(); i++) link(i);
+}
+
+// arenaBytes() function implementation: 
+// Returns the bytes stored in the arena. 
+template <typename V, typename H>
+std::size_t StringHashMap<V, H>::arenaBytes() const { return arena.usedBytes(); }
+
+// link() function implementation: 
+// Pushes entry (i) onto the front of the chain of its bucket. 
+template <typename V, typename H>
+void StringHashMap<V, H>::link(int i) {
+    std::size_t b = S[i].hash % B.size();
+    S[i].next = B[b];
+    B[b] = i;
+}
+
+// finder() function implementation: 
+// Walks the chain of key (k), whose folded hash is (h), and returns the index of its entry or -1. 
+// A short key is first laid out like a stored one, so every candidate is compared as two words; a long key is only
+// compared with long entries whose cached hash matches.
+template <typename V, typename H>
+int StringHashMap<V, H>::finder(std::string_view k, std::uint32_t h) const {
+    int j = B[h % B.size()];
+    if (StringKey::fits(k)) {
+        StringKey probe;
+        probe.setInline(k);
+        while (j >= 0 && !(S[j].hash == h && S[j].k.sameInline(probe))) j = S[j].next;
+    } else {
+        while (j >= 0 && !(S[j].hash == h && S[j].k.isLong() && S[j].k.view() == k)) j = S[j].next;
+    }
+    return j;
+}
+
+// find() function implementation: 
+// Finds the entry for the given key (k) and returns an iterator to it, or end(). 
+template <typename V, typename H>
+typename StringHashMap<V, H>::Iterator StringHashMap<V, H>::find(std::string_view k) {
+    int i = finder(k, fold(hash(k)));
+    return i < 0 ? end() : Iterator(S, i);
+}
+
+// put() function implementation: 
+// Inserts a (k, v) pair, or replaces the value if key (k) already exists. 
+template <typename V, typename H>
+typename StringHashMap<V, H>::Iterator StringHashMap<V, H>::put(std::string_view k, const V& v) {
+    std::uint32_t h = fold(hash(k));
+    int i = finder(k, h);
+    if (i < 0) return inserter(k, h, v);
+    S[i].v = v;
+    return Iterator(S, i);
+}
+
+// put(std::string_view, V&&) function implementation: 
+// Same as put() above, but moves the value into the map. 
+template <typename V, typename H>
+typename StringHashMap<V, H>::Iterator StringHashMap<V, H>::put(std::string_view k, V&& v) {
+    std::uint32_t h = fold(hash(k));
+    int i = finder(k, h);
+    if (i < 0) return inserter(k, h, std::move(v));
+    S[i].v = std::move(v);
+    return Iterator(S, i);
+}
+
+// eraser() function implementation: 
+// Unlinks entry (i), releases its long key, and moves the last entry into its place (redirecting the link that 
+// pointed to the last entry). Rebuilds the arena once more than half of it belongs to erased keys.
+template <typename V, typename H>
+void StringHashMap<V, H>::eraser(int i) {
+    int* p = &B[S[i].hash % B.size()]; // Find the link pointing to entry (i), 
+    while (*p != i) p = &S[*p].next;
+    *p = S[i].next;                    // and bypass the entry. 
+    if (S[i].k.isLong()) arena.release(S[i].k.view().size());
+    int last = size() - 1;
+    if (i != last) {                   // Fill the hole with the last entry. 
+        int* q = &B[S[last].hash % B.size()];
+        while (*q != last) q = &S[*q].next;
+        *q = i;
+        S[i] = std::move(S[last]);
+    }
+    S.pop_back();
+    if (arena.wastedBytes() > 4096 && arena.wastedBytes() * 2 > arena.usedBytes()) compact();
+}
+
+// compact() function implementation: 
+// Copies the long keys that are still in use into a new arena and drops the old one. 
+template <typename V, typename H>
+void StringHashMap<V, H>::compact() {
+    KeyArena fresh;
+    for (std::size_t i = 0; i < S.size(); i++) {
+        StringKey& k = S[i].k;
+        if (k.isLong()) {
+            std::string_view v = k.view();
+            k.setLong(fresh.store(v.data(), v.size()), v.size());
+        }
+    }
+    arena.swap(fresh);                 // The old chunks are released with (fresh). 
+}
+
+// erase(std::string_view) function implementation: 
+// Deletes the entry with key (k), if there is one. 
+template <typename V, typename H>
+void StringHashMap<V, H>::erase(std::string_view k) {
+    int i = finder(k, fold(hash(k)));
+    if (i >= 0) eraser(i);
+}
+
+// erase(const Iterator&) function implementation: 
+// Deletes the entry pointed to by iterator (p). 
+template <typename V, typename H>
+void StringHashMap<V, H>::erase(const Iterator& p) { eraser(p.idx); }
+
+// begin() function implementation: 
+// Returns an iterator to the first entry of the entry array. 
+template <typename V, typename H>
+typename StringHashMap<V, H>::Iterator StringHashMap<V, H>::begin() { return Iterator(S, 0); }
+
+// end() function implementation: 
+// Returns an iterator just past the last entry of the entry array. 
+template <typename V, typename H>
+typename StringHashMap<V, H>::Iterator StringHashMap<V, H>::end() { return Iterator(S, size()); }
+
+// Explicit instantiation of the StringHashMap template for int values.
+template class StringHashMap<int, stringHash>;
+template class StringHashMap<int, fastStringHash>;
\ No newline at end of file
@@ -0,0 +1,247 @@
+#pragma once // Ensures this header file is included only once.
+
+#include "hashMap.h" // Includes stringHash and fastStringHash.
+
+#include <cstdint>     // Includes std::uint32_t and std::uint64_t.
+#include <cstring>     // Includes std::memcpy and std::memcmp.
+#include <memory>      // Includes std::unique_ptr, which owns the chunks of a KeyArena.
+#include <string_view> // Includes std::string_view, the key type seen by users of StringHashMap.
+#include <utility>     // Includes std::move and std::swap.
+#include <vector>      // Includes std::vector, used for the entry array, the bucket array and the arena chunks.
+
+// Class StringKey. Stores a string key in 16 bytes. Keys of up to INLINE bytes are kept inside the object itself,
+// padded with zero bytes; longer keys are kept in a KeyArena and the object holds their address and length.
+// The last byte tells the two apart: it is the length of an inline key, or LONG for a key in the arena.
+class StringKey {
+public:
+    static constexpr std::size_t INLINE = 15;   // Longest key stored inline. 
+    static constexpr unsigned char LONG = 0xFF; // Tag of a key stored in an arena. 
+
+    // Constructor: An empty inline key. 
+    StringKey() { std::memset(bytes, 0, sizeof(bytes)); }
+
+    // Returns true if key (k) is short enough to be stored inline. 
+    static bool fits(std::string_view k) { return k.size() <= INLINE; }
+
+    // Stores the short key (k) inline; fits(k) must be true. 
+    void setInline(std::string_view k) {
+        std::memset(bytes, 0, sizeof(bytes));       // The padding must be zero so that keys compare as words. 
+        if (!k.empty()) std::memcpy(bytes, k.data(), k.size());
+        bytes[15] = (unsigned char)k.size();
+    }
+    // Refers to the long key stored at (p) with (length) bytes. 
+    void setLong(const char* p, std::size_t length) {
+        std::uint32_t len = std::uint32_t(length);
+        std::memcpy(bytes, &p, sizeof(p));
+        std::memcpy(bytes + 8, &len, sizeof(len));
+        bytes[15] = LONG;
+    }
+
+    // Returns true if the key lives in an arena. 
+    bool isLong() const { return bytes[15] == LONG; }
+    // Returns the characters of the key. 
+    std::string_view view() const {
+        if (!isLong()) return std::string_view(reinterpret_cast<const char*>(bytes), bytes[15]);
+        const char* p;
+        std::uint32_t len;
+        std::memcpy(&p, bytes, sizeof(p));
+        std::memcpy(&len, bytes + 8, sizeof(len));
+        return std::string_view(p, len);
+    }
+    // Returns true if this key and the inline key (k) are equal, by comparing all 16 bytes (length included) as two 
+    // 64-bit words. No characters are compared one by one and no pointer is followed. 
+    bool sameInline(const StringKey& k) const {
+        std::uint64_t a[2], b[2];
+        std::memcpy(a, bytes, 16);
+        std::memcpy(b, k.bytes, 16);
+        return ((a[0] ^ b[0]) | (a[1] ^ b[1])) == 0;
+    }
+
+private:
+    unsigned char bytes[16]; // Inline characters and length, or address and length of a long key. 
+};
+
+// Class KeyArena. Holds the characters of long keys in large chunks, so a long key costs no separate allocation.
+// Chunks never move, so the address of a stored key stays valid until the arena is cleared or destroyed. Erased keys
+// are not reclaimed one by one; the arena only counts their bytes, and the owner rebuilds it once they dominate.
+class KeyArena {
+public:
+    // Constructor: An empty arena. 
+    KeyArena();
+
+    // Copies the (length) bytes at (p) into the arena and returns the address of the copy. 
+    const char* store(const char* p, std::size_t length);
+    // Records that a stored key of (length) bytes is no longer used. 
+    void release(std::size_t length) { wasted += length; }
+
+    // Returns the number of bytes stored, including released ones. 
+    std::size_t usedBytes() const { return used; }
+    // Returns the number of released bytes. 
+    std::size_t wastedBytes() const { return wasted; }
+
+    // Exchanges the contents of two arenas. 
+    void swap(KeyArena& other);
+
+private:
+    static constexpr std::size_t CHUNK = 64 * 1024; // Size of an ordinary chunk; longer keys get a chunk of their own. 
+
+    std::vector<std::unique_ptr<char[]> > chunks; // Every chunk allocated so far. 
+    char* cur;           // Next free byte of the current chunk. 
+    std::size_t left;    // Free bytes left in the current chunk. 
+    std::size_t used;    // Bytes stored. 
+    std::size_t wasted;  // Bytes of released keys. 
+};
+
+// Template class StringHashMap. A hash map from strings to values of type (V), hashed with (H), specialized for
+// string keys. Compared with HashMap<std::string, V, H>:
+// - A key is stored in a 16-byte StringKey instead of a 32-byte std::string. Keys of up to 15 bytes (most keys in
+//   practice) live inline in the entry; longer keys are copied into a KeyArena rather than into their own allocation.
+// - Every entry caches 32 bits of its hash, and short keys are compared as two 64-bit words.
+// With V = int an entry takes 28 bytes instead of 48 (plus 4 bytes per bucket), and a long key costs its length
+// instead of a heap block. Entries are kept densely like in HashMap, so iteration is a sequential sweep.
+// Keys are passed and returned as std::string_view; a std::string or a string literal converts implicitly.
+template <typename V, typename H>
+class StringHashMap {
+public:
+    // Class Entry. A (key, value) pair of the map. The key cannot be changed. 
+    class Entry {
+    public:
+        // Returns the key. The view points into the map and stays valid only until the next put(), erase() or 
+        // reserve(): those can move the entry (and an inline key with it) or compact the arena holding long keys. 
+        std::string_view key() const { return k.view(); }
+        // Returns the value. 
+        const V& value() const { return v; }
+        // Sets the value. 
+        void setValue(const V& x) { v = x; }
+        // Sets the value by moving (x) into the entry. 
+        void setValue(V&& x) { v = std::move(x); }
+
+    private:
+        StringKey k;          // The key. 
+        V v;                  // The value. 
+        std::uint32_t hash;   // 32 bits of the hash value of the key. 
+        int next;             // Index of the next entry in the same bucket, or -1. 
+
+        friend class StringHashMap; // Grants the map access to the key, the hash and the chain link. 
+    };
+
+    // Declaration of the inner Iterator class for StringHashMap. 
+    class Iterator;
+
+public:
+    // Constructor: Sets the initial capacity of the hash map's buckets. Default is 100. 
+    StringHashMap(int capacity = 100);
+    // Copy constructor: Copies every entry of (other); long keys are copied into this map's own arena. 
+    StringHashMap(const StringHashMap& other);
+    // Copy assignment: Replaces the contents of this map with a copy of (other). 
+    StringHashMap& operator=(const StringHashMap& other);
+
+    // Returns the number of entries (key-value pairs) currently stored in the hash map. 
+    int size() const;
+
+    // Returns true if the map is empty. 
+    bool empty() const;
+
+    // Returns the number of buckets in the bucket array. 
+    int bucketCount() const;
+
+    // Returns the current load factor, i.e. the average number of entries per bucket. 
+    float loadFactor() const;
+
+    // Returns the load factor above which put() grows the bucket array. 
+    float maxLoadFactor() const;
+
+    // Sets the maximum load factor (f > 0) and rehashes right away if it is already exceeded. 
+    void setMaxLoadFactor(float f);
+
+    // Makes room for at least (count) entries without exceeding the maximum load factor. 
+    void reserve(int count);
+
+    // Redistributes all entries into a bucket array with (at least) the given number of buckets. 
+    void rehash(int buckets);
+
+    // Returns the number of bytes held by the arena for long keys, including those of erased keys not yet reclaimed. 
+    std::size_t arenaBytes() const;
+
+    // Finds an entry with key k and returns an iterator to it. 
+    Iterator find(std::string_view k);
+
+    // Inserts or replaces a (k,v) pair in the map. 
+    Iterator put(std::string_view k, const V& v);
+
+    // Inserts or replaces a (k,v) pair in the map, moving the value in instead of copying it. 
+    Iterator put(std::string_view k, V&& v);
+
+    // Removes an entry with key k. 
+    void erase(std::string_view k);
+
+    // Erases the entry at position p. As in HashMap, the last entry is moved into position p. 
+    void erase(const Iterator& p);
+
+    // Returns an iterator to the first entry in the map. 
+    Iterator begin();
+
+    // Returns an iterator to the end entry (past-the-end) of the map. 
+    Iterator end();
+
+protected:
+    typedef std::vector<Entry> EntryArray; // Defines 'EntryArray' as the dense array holding the entries. 
+    typedef std::vector<int> BktArray;     // Defines 'BktArray' as a vector holding the first entry of each bucket (-1 if empty). 
+
+    // Utility functions for StringHashMap operations. 
+    static std::uint32_t fold(std::size_t h);  // Folds a hash value (h) to the 32 bits kept in an entry. 
+    int finder(std::string_view k, std::uint32_t h) const; // Internal utility function returning the index of key (k), or -1. 
+    void link(int i);                          // Internal utility function adding entry (i) to the chain of its bucket. 
+    template <typename VV>
+    Iterator inserter(std::string_view k, std::uint32_t h, VV&& v); // Internal utility function appending a new entry. 
+    void eraser(int i);                        // Internal utility function to remove entry (i). 
+    void compact();                            // Internal utility function copying the live long keys into a fresh arena. 
+
+private:
+    float maxLoad;   // The maximum load factor (S.size() / B.size()) tolerated before the bucket array grows. 
+    H hash;          // The hash function object. 
+    EntryArray S;    // The entry array where the actual data is stored, without gaps. 
+    BktArray B;      // The bucket array, holding the head of every bucket chain. 
+    KeyArena arena;  // The characters of every long key. 
+
+public:
+    // Definition of the StringHashMap::Iterator class. 
+    class Iterator {
+    private:
+        int idx;         // The position of the entry within the entry array. 
+        EntryArray* ea;  // A pointer to the entry array this iterator belongs to. 
+
+    public:
+        // Iterator constructor: Initializes the iterator with the entry array (a) and a position (i) in it. 
+        Iterator(EntryArray& a, int i) : idx(i), ea(&a) { }
+
+        // Overloads the dereference operator to return a reference to the Entry pointed to by the iterator. 
+        Entry& operator*() const { return (*ea)[idx]; }
+        // Overloads the equality operator to compare if two Iterator objects point to the same location. 
+        bool operator==(const Iterator& p) const { return ea == p.ea && idx == p.idx; }
+        // Overloads the pre-increment operator to advance the iterator to the next entry. 
+        Iterator& operator++() { ++idx; return *this; }
+
+        friend class StringHashMap; // Grants the StringHashMap class access to the private members of Iterator. 
+    };
+};
+
+// Member template definitions.
+
+// inserter() function implementation: 
+// Appends an entry for the absent key (k) with folded hash (h) and value (v), storing a long key in the arena, then 
+// links it, doubling the bucket array first if the map would exceed its maximum load factor.
+template <typename V, typename H>
+template <typename VV>
+typename StringHashMap<V, H>::Iterator StringHashMap<V, H>::inserter(std::string_view k, std::uint32_t h, VV&& v) {
+    Entry e;
+    if (StringKey::fits(k)) e.k.setInline(k);                 // Short key: copy it into the entry. 
+    else e.k.setLong(arena.store(k.data(), k.size()), k.size()); // Long key: copy it into the arena. 
+    e.v = std::forward<VV>(v);
+    e.hash = h;
+    S.push_back(std::move(e));
+    int i = size() - 1;
+    if (size() > maxLoad * B.size()) rehash(2 * B.size()); // Too many entries: double the buckets (links entry i). 
+    else link(i);
+    return Iterator(S, i);
+}
\ No newline at end of file